@@ -0,0 +1,94 @@
+#include "simulation.hpp"
+#include "autopilot.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// 할당 검사 - make alloccheck가 실행함
+// 자동 조종기로 게임을 돌리면서 GameState::step() 안에서만 operator new 호출을 세고,
+// 한 번이라도 있으면 실패함 (스테이지가 바뀌거나 게임이 끝나는 틱은 맵을 다시 놓으므로 셈에서 뺌)
+
+static bool counting = false;  // step() 도중에만 켬
+static long allocations = 0;   // 센 할당 수
+
+void* operator new(size_t size) {
+    if (counting) ++allocations;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    free(p);
+}
+
+static void printUsage(const char* program) {
+    fprintf(stderr, "usage: %s [--ticks N] [--warmup N] [--seed N]\n", program);
+}
+
+int main(int argc, char* argv[]) {
+    long ticks = 20000;   // 세는 틱 수
+    long warmup = 400;    // 게임마다 세지 않고 먼저 돌리는 틱 수 (버퍼가 자리 잡을 때까지)
+    uint64_t seed = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) ticks = atol(argv[++i]);
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) warmup = atol(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    const int width = 42, height = 21;
+    GameState state(width, height, seed);
+    state.setDamageTracking(false);
+    Autopilot pilot(width, height);
+
+    long counted = 0, skipped = 0, gameTicks = 0;
+    int games = 1;
+    while (counted < ticks) {
+        if (state.isOver()) {
+            state.reset(seed + games++);
+            pilot.clear();
+            gameTicks = 0;
+        }
+        Action action = state.movesOnNextStep() ? pilot.decide(state) : ACT_NONE;
+
+        int stage = state.getStageLevel();
+        long before = allocations;
+        counting = gameTicks >= warmup;
+        state.step(action);
+        counting = false;
+        ++gameTicks;
+        if (gameTicks <= warmup) continue;
+
+        if (state.isOver() || state.getStageLevel() != stage) {
+            allocations = before;
+            ++skipped;
+            continue;
+        }
+        ++counted;
+    }
+
+    printf("alloccheck: %ld steady-state ticks over %d games (%ld stage/game-end ticks skipped), %ld allocations\n",
+           counted, games, skipped, allocations);
+    return allocations == 0 ? 0 : 1;
+}
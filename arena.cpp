@@ -0,0 +1,241 @@
+#include "arena.hpp"
+#include <algorithm>
+
+// 머리 요청 값 - 상위 32비트 길이, 하위 32비트 그 길이로 요청한 뱀 수
+static uint64_t claimValue(uint32_t length, uint32_t count) {
+    return (static_cast<uint64_t>(length) << 32) | count;
+}
+
+// 역방향인지
+static bool reverses(Direction from, Direction to) {
+    return (from == UP && to == DOWN) || (from == DOWN && to == UP) ||
+           (from == LEFT && to == RIGHT) || (from == RIGHT && to == LEFT);
+}
+
+// 방향으로 한 칸 옮긴 칸 번호
+static int stepCell(int cell, Direction dir, int width) {
+    switch (dir) {
+        case UP:    return cell - width;
+        case DOWN:  return cell + width;
+        case LEFT:  return cell - 1;
+        case RIGHT: return cell + 1;
+    }
+    return cell;
+}
+
+// 생성자 - 테두리 벽을 두르고 모든 뱀과 먹이를 놓음
+Arena::Arena(int width, int height, int snakeCount, uint64_t seed, int threads)
+    : width(width), height(height), map(width, height), owner(width * height, 0),
+      claims(new atomic<uint64_t>[width * height]), snakes(snakeCount), target(snakeCount, -1),
+      grows(snakeCount, 0), fate(snakeCount, OVER_NONE), rng(seed), foodTarget(max(1, snakeCount / 2)),
+      foodCount(0), aliveCount(0), tick(0), pool(threads), pendingActions(nullptr) {
+    for (int i = 0; i < width * height; ++i) claims[i].store(0, memory_order_relaxed);
+    for (int x = 0; x < width; ++x) {
+        map.set(x, 0, CELL_WALL);
+        map.set(x, height - 1, CELL_WALL);
+    }
+    for (int y = 0; y < height; ++y) {
+        map.set(0, y, CELL_WALL);
+        map.set(width - 1, y, CELL_WALL);
+    }
+
+    for (int i = 0; i < snakeCount; ++i) {
+        ArenaSnake& snake = snakes[i];
+        snake.body.assign(8, 0);
+        snake.head = 0;
+        snake.count = 0;
+        snake.dir = RIGHT;
+        snake.alive = false;
+        snake.respawnTick = 0;
+        snake.deaths = 0;
+        snake.lastDeath = OVER_NONE;
+        respawn(i);
+    }
+    spawnFood();
+}
+
+// 한 틱 진행 - 병렬 단계 사이는 parallelFor가 끝날 때까지 기다리는 것으로 나뉨
+void Arena::step(const Action* actions) {
+    ++tick;
+    pendingActions = actions;
+    int grain = size() / (pool.size() * 8);
+    if (grain < 128) grain = 128;
+
+    auto propose = [this](int begin, int end) { proposeRange(begin, end); };
+    auto resolve = [this](int begin, int end) { resolveRange(begin, end); };
+    auto vacate = [this](int begin, int end) { vacateRange(begin, end); };
+    auto commit = [this](int begin, int end) { commitRange(begin, end); };
+    pool.parallelFor(size(), grain, propose);
+    pool.parallelFor(size(), grain, resolve);
+    pool.parallelFor(size(), grain, vacate);
+    pool.parallelFor(size(), grain, commit);
+    pendingActions = nullptr;
+
+    // 집계와 부활은 뱀 번호 순서로 (난수 순서가 스레드 수와 무관하도록)
+    for (int i = 0; i < size(); ++i) {
+        if (fate[i] != OVER_NONE) --aliveCount;
+        else if (target[i] >= 0 && grows[i]) --foodCount;
+        if (!snakes[i].alive && snakes[i].respawnTick <= tick) respawn(i);
+    }
+    spawnFood();
+}
+
+// 1단계 - 방향 적용, 다음 머리 칸 제안, 칸별 요청 기록
+void Arena::proposeRange(int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        ArenaSnake& snake = snakes[i];
+        target[i] = -1;
+        fate[i] = OVER_NONE;
+        grows[i] = 0;
+        if (!snake.alive) continue;
+
+        Direction dir = snake.dir;
+        switch (pendingActions[i]) {
+            case ACT_UP:    dir = UP; break;
+            case ACT_DOWN:  dir = DOWN; break;
+            case ACT_LEFT:  dir = LEFT; break;
+            case ACT_RIGHT: dir = RIGHT; break;
+            case ACT_NONE:  break;
+        }
+
+        // 역방향 입력은 움직이지 않은 채 자기 몸에 부딪힌 것으로 처리 (꼬리도 그대로 남음)
+        if (reverses(snake.dir, dir)) {
+            fate[i] = OVER_SELF;
+            continue;
+        }
+        snake.dir = dir;
+
+        int cell = stepCell(snake.segmentAt(0), dir, width);
+        target[i] = cell;
+        grows[i] = map.atIndex(cell) == CELL_GROW;
+
+        // 가장 긴 요청 길이와 그 길이의 요청 수 - 어떤 순서로 기록해도 같은 값이 됨
+        uint32_t length = static_cast<uint32_t>(snake.count);
+        uint64_t seen = claims[cell].load(memory_order_relaxed);
+        while (true) {
+            uint32_t best = static_cast<uint32_t>(seen >> 32);
+            if (length < best) break;
+            uint64_t next = length > best ? claimValue(length, 1) : seen + 1;
+            if (claims[cell].compare_exchange_weak(seen, next, memory_order_relaxed)) break;
+        }
+    }
+}
+
+// 2단계 - 충돌 판정 (공유 상태는 읽기만 함)
+void Arena::resolveRange(int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        int cell = target[i];
+        if (cell < 0) continue;
+
+        Cell terrain = map.atIndex(cell);
+        if (terrain == CELL_WALL || terrain == CELL_IMMUNE_WALL) {
+            fate[i] = OVER_WALL;
+            continue;
+        }
+
+        // 머리끼리 - 더 긴 뱀만 살아남고, 가장 긴 뱀이 여럿이면 모두 죽음
+        uint64_t claim = claims[cell].load(memory_order_relaxed);
+        if ((claim >> 32) > static_cast<uint64_t>(snakes[i].count) || (claim & 0xFFFFFFFFu) > 1) {
+            fate[i] = OVER_SNAKE;
+            continue;
+        }
+
+        // 머리-몸통 - 이번 틱에 빠지는 꼬리만 지나갈 수 있음 (이번 틱에 죽는 뱀의 몸통도 막힘)
+        int other = owner[cell] - 1;
+        if (other >= 0) {
+            bool leaving = target[other] >= 0 && !grows[other] && snakes[other].tail() == cell;
+            if (!leaving) fate[i] = (other == i) ? OVER_SELF : OVER_SNAKE;
+        }
+    }
+}
+
+// 3단계 - 요청 지우기, 죽은 뱀 몸통과 빠지는 꼬리를 점유 격자에서 제거
+void Arena::vacateRange(int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        ArenaSnake& snake = snakes[i];
+        if (target[i] >= 0) claims[target[i]].store(0, memory_order_relaxed);
+        if (!snake.alive) continue;
+
+        if (fate[i] != OVER_NONE) {
+            for (int k = 0; k < snake.count; ++k) owner[snake.segmentAt(k)] = 0;
+            snake.count = 0;
+            snake.alive = false;
+            snake.respawnTick = static_cast<int>(tick) + ARENA_RESPAWN_TICKS;
+            ++snake.deaths;
+            snake.lastDeath = static_cast<GameOverReason>(fate[i]);
+        } else if (!grows[i]) {
+            owner[snake.tail()] = 0;
+            --snake.count;
+        }
+    }
+}
+
+// 4단계 - 살아남은 뱀의 머리 기록, 먹은 먹이 제거
+void Arena::commitRange(int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        int cell = target[i];
+        if (cell < 0 || fate[i] != OVER_NONE) continue;
+        pushHead(snakes[i], cell);
+        owner[cell] = i + 1;
+        if (grows[i]) map.set(cell % width, cell / width, CELL_EMPTY);
+    }
+}
+
+// 머리 추가 - 링 버퍼가 차면 두 배로 늘림
+void Arena::pushHead(ArenaSnake& snake, int cell) {
+    int capacity = static_cast<int>(snake.body.size());
+    if (snake.count == capacity) {
+        vector<int> grown(capacity * 2);
+        for (int k = 0; k < snake.count; ++k) grown[k + 1] = snake.segmentAt(k);
+        snake.body.swap(grown);
+        snake.head = 1;
+        capacity *= 2;
+    }
+    snake.head = (snake.head == 0) ? capacity - 1 : snake.head - 1;
+    snake.body[snake.head] = cell;
+    ++snake.count;
+}
+
+// 빈 자리에 길이 3으로 다시 놓기 - 몸통 세 칸과 바로 앞 칸이 비어 있어야 함
+bool Arena::respawn(int i) {
+    ArenaSnake& snake = snakes[i];
+    for (int attempt = 0; attempt < ARENA_SPAWN_TRIES; ++attempt) {
+        int x = 1 + rng.below(width - 2);
+        int y = 1 + rng.below(height - 2);
+        Direction dir = static_cast<Direction>(rng.below(4));
+        int head = map.index(x, y);
+
+        // 꼬리부터 앞 칸까지 (dir 방향으로 연속된 네 칸)
+        Direction back = (dir == UP) ? DOWN : (dir == DOWN) ? UP : (dir == LEFT) ? RIGHT : LEFT;
+        int cells[ARENA_START_LENGTH];
+        cells[0] = head;
+        for (int k = 1; k < ARENA_START_LENGTH; ++k) cells[k] = stepCell(cells[k - 1], back, width);
+        int ahead = stepCell(head, dir, width);
+
+        bool fits = cellFree(ahead);
+        for (int k = 0; k < ARENA_START_LENGTH && fits; ++k) fits = cellFree(cells[k]);
+        if (!fits) continue;
+
+        snake.count = 0;
+        snake.head = 0;
+        for (int k = ARENA_START_LENGTH - 1; k >= 0; --k) {
+            pushHead(snake, cells[k]);
+            owner[cells[k]] = i + 1;
+        }
+        snake.dir = dir;
+        snake.alive = true;
+        ++aliveCount;
+        return true;
+    }
+    return false;
+}
+
+// 먹이를 목표 수까지 보충 - 빈 칸을 무작위로 찍어 봄 (맵이 거의 차 있으면 다음 틱에 다시)
+void Arena::spawnFood() {
+    for (int attempt = 0; foodCount < foodTarget && attempt < ARENA_SPAWN_TRIES; ++attempt) {
+        int cell = rng.below(width * height);
+        if (!cellFree(cell)) continue;
+        map.set(cell % width, cell / width, CELL_GROW);
+        ++foodCount;
+    }
+}
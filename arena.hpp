@@ -0,0 +1,91 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include "simulation.hpp"
+#include "threadpool.hpp"
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+using namespace std;
+
+const int ARENA_RESPAWN_TICKS = 40;   // 죽은 뱀이 다시 나오기까지 (1초)
+const int ARENA_SPAWN_TRIES = 16;     // 부활/먹이 자리를 찾는 무작위 시도 횟수 (틱당, 하나마다)
+const int ARENA_START_LENGTH = 3;
+
+// ArenaSnake 구조체 - 아레나의 뱀 하나 (몸통은 칸 번호 링 버퍼, 길어지면 두 배로 늘림)
+struct ArenaSnake {
+    vector<int> body;          // 몸통 칸 번호 링 버퍼
+    int head;                  // 머리 위치
+    int count;                 // 몸통 길이
+    Direction dir;             // 진행 방향
+    bool alive;
+    int respawnTick;           // 죽은 뒤 다시 나올 틱
+    int deaths;                // 죽은 횟수
+    GameOverReason lastDeath;  // 마지막으로 죽은 사유
+
+    int segmentAt(int i) const { return body[(head + i) % body.size()]; }  // i번째 칸 (0 = 머리)
+    int tail() const { return segmentAt(count - 1); }
+};
+
+// Arena 클래스 - 여러 뱀이 한 맵을 함께 쓰는 대전 모드
+// 모든 뱀이 매 step()마다 한 칸씩 움직이고, 한 틱은 병렬 단계 네 번으로 나눠 처리함
+//   1. 제안: 각 뱀이 다음 머리 칸을 정하고 칸별 점유 요청(claim)에 원자적으로 기록
+//   2. 판정: 벽, 머리끼리(긴 뱀이 이기고 같으면 모두 죽음), 머리-몸통 충돌 확인 (공유 상태는 읽기만)
+//   3. 비우기: 죽은 뱀 몸통과 움직인 꼬리를 점유 격자에서 지움
+//   4. 커밋: 살아남은 뱀의 머리를 점유 격자에 씀 (머리 칸은 서로 겹치지 않음)
+// 각 단계의 쓰기는 순서와 무관한 결과를 내므로 스레드 수가 달라도 결과가 같음
+// 먹이/부활처럼 난수를 쓰는 일은 마지막에 한 스레드가 뱀 번호 순서로 처리함
+class Arena {
+public:
+    // 생성자 - threads가 0 이하이면 코어 수만큼, 같은 시드면 같은 경기
+    Arena(int width, int height, int snakes, uint64_t seed, int threads);
+
+    // actions[i]를 i번째 뱀에 적용하고 한 틱 진행 (죽어 있는 뱀의 입력은 무시)
+    void step(const Action* actions);
+
+    int size() const { return static_cast<int>(snakes.size()); }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getThreadCount() const { return pool.size(); }
+    long getTick() const { return tick; }
+    int getAliveCount() const { return aliveCount; }
+    int getFoodCount() const { return foodCount; }
+    const StageMap& getMap() const { return map; }
+    const ArenaSnake& getSnake(int i) const { return snakes[i]; }
+
+    // 칸을 차지한 뱀 번호 (없으면 -1)
+    int ownerAt(int index) const { return owner[index] - 1; }
+
+private:
+    void proposeRange(int begin, int end);   // 1단계
+    void resolveRange(int begin, int end);   // 2단계
+    void vacateRange(int begin, int end);    // 3단계
+    void commitRange(int begin, int end);    // 4단계
+    void spawnFood();                        // 먹이 보충
+    bool respawn(int i);                     // i번째 뱀을 빈 자리에 놓음 - 자리가 없으면 false
+    void pushHead(ArenaSnake& snake, int cell);
+    bool cellFree(int cell) const { return map.atIndex(cell) == CELL_EMPTY && owner[cell] == 0; }
+
+    int width, height;
+    StageMap map;                            // 벽과 먹이 (CELL_GROW)
+    vector<int32_t> owner;                   // 칸별 뱀 번호 + 1 (0이면 빈 칸)
+    unique_ptr<atomic<uint64_t>[]> claims;   // 칸별 머리 요청 - 상위 32비트 최대 길이, 하위 32비트 그 길이의 뱀 수
+    vector<ArenaSnake> snakes;
+
+    // 이번 틱의 뱀별 제안/판정 (필드별 배열)
+    vector<int> target;                      // 다음 머리 칸 (-1이면 움직이지 않음)
+    vector<uint8_t> grows;                   // 먹이를 먹어 꼬리를 남기는지
+    vector<uint8_t> fate;                    // 판정 결과 (GameOverReason, OVER_NONE이면 생존)
+
+    Rng rng;                                 // 먹이/부활 위치 (한 스레드에서만 씀)
+    int foodTarget;                          // 유지할 먹이 수
+    int foodCount;
+    int aliveCount;
+    long tick;
+    ThreadPool pool;
+    const Action* pendingActions;            // step() 동안만 유효
+};
+
+#endif
@@ -0,0 +1,468 @@
+#include "autopilot.hpp"
+#include "input.hpp"
+#include "profiler.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+// 방향별 이동 (UP, DOWN, LEFT, RIGHT 순서)
+static const int stepX[4] = { 0, 0, -1, 1 };
+static const int stepY[4] = { -1, 1, 0, 0 };
+
+// 반대 방향
+static const Direction opposite[4] = { DOWN, UP, RIGHT, LEFT };
+
+// 게이트 출구 방향 우선순위 - GameState::useGate()와 같은 표
+static const Direction exitPriorities[4][4] = {
+    { UP, RIGHT, LEFT, DOWN },     // UP
+    { DOWN, RIGHT, LEFT, UP },     // DOWN
+    { LEFT, UP, DOWN, RIGHT },     // LEFT
+    { RIGHT, DOWN, UP, LEFT },     // RIGHT
+};
+
+// 바람개비 날이 지나가는 8방향
+static const int sweepRays[8][2] = {
+    { 0, -1 }, { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }
+};
+
+// 링크 값 - 입력 방향 2비트, 이동 뒤 방향 2비트, 게이트 통과 표시
+const uint8_t LINK_GATE = 16;
+
+static Direction linkMove(uint8_t value) { return static_cast<Direction>(value & 3); }
+static Direction linkHeading(uint8_t value) { return static_cast<Direction>((value >> 2) & 3); }
+
+// 좌표 쌍 -> 칸 번호 (게이트가 없으면 -1)
+static int gateIndex(const pair<int, int>& gate, int width) {
+    return gate.first < 0 ? -1 : gate.second * width + gate.first;
+}
+
+// 생성자 - 탐색 버퍼는 여기서 한 번만 할당함
+Autopilot::Autopilot(int width, int height)
+    : width(width), height(height), seen(width * height, 0), cost(width * height, 0), link(width * height, 0),
+      bodyMark(width * height, 0), danger(width * height, 0), generation(0), finishFrom(-1), finishLink(0), bodyGeneration(0),
+      expectedHead(-1), planTarget(-1), planTargetCell(CELL_EMPTY), movingTail(-1),
+      wantPoison(false), wantGate(false), riskDanger(false), decisions(0), replans(0), expanded(0) {
+    open.reserve(AUTOPILOT_SEARCH_LIMIT * 3);
+    queue.reserve(AUTOPILOT_SEARCH_LIMIT);
+    plan.reserve(AUTOPILOT_SEARCH_LIMIT);
+}
+
+// 남은 계획 버리기
+void Autopilot::clear() {
+    plan.clear();
+    expectedHead = -1;
+    planTarget = -1;
+    planTargetCell = CELL_EMPTY;
+}
+
+// 이번 틱 입력 - 계획이 아직 맞으면 다음 이동만 꺼내고, 아니면 다시 계획함
+Action Autopilot::decide(const GameState& state) {
+    if (state.isOver() || !state.movesOnNextStep()) return ACT_NONE;
+    PROFILE_SCOPE(PHASE_AUTOPILOT);
+    ++decisions;
+
+    const Serpent& serpent = state.getSerpent();
+    PackedCell tail = serpent.getTail();
+    movingTail = serpent.growsOnNextMove() ? -1 : cellY(tail) * width + cellX(tail);
+    wantPoison = state.getPoisonScore() < state.getMissionPoison() && serpent.length() > 3;
+    wantGate = state.getGateScore() < state.getMissionGate();
+    riskDanger = false;
+    syncWindmills(state);
+
+    if (!planValid(state)) {
+        ++replans;
+        replan(state);
+    }
+    if (plan.empty()) {
+        expectedHead = -1;
+        return ACT_NONE;
+    }
+
+    Step next = plan.back();
+    plan.pop_back();
+    expectedHead = next.cell;
+    return next.dir == serpent.getCurrentDirection() ? ACT_NONE : actionFor(next.dir);
+}
+
+// 바람개비가 바뀌었을 때만 (스테이지 시작) 날이 지나가는 칸을 다시 표시 - 표시한 칸만 지움
+void Autopilot::syncWindmills(const GameState& state) {
+    const vector<Windmill>& windmills = state.getWindmills();
+    bool same = windmillKey.size() == windmills.size() * 3;
+    for (size_t w = 0; same && w < windmills.size(); ++w) {
+        same = windmillKey[w * 3] == windmills[w].center.first && windmillKey[w * 3 + 1] == windmills[w].center.second &&
+               windmillKey[w * 3 + 2] == windmills[w].length;
+    }
+    if (same) return;
+
+    for (int cell : dangerCells) danger[cell] = 0;
+    dangerCells.clear();
+    windmillKey.clear();
+    for (const Windmill& windmill : windmills) {
+        windmillKey.push_back(windmill.center.first);
+        windmillKey.push_back(windmill.center.second);
+        windmillKey.push_back(windmill.length);
+        for (const int* ray : sweepRays) {
+            for (int i = 1; i <= windmill.length; ++i) {
+                int x = windmill.center.first + ray[0] * i;
+                int y = windmill.center.second + ray[1] * i;
+                if (x < 0 || x >= width || y < 0 || y >= height) break;
+                int cell = y * width + x;
+                if (!danger[cell]) {
+                    danger[cell] = 1;
+                    dangerCells.push_back(cell);
+                }
+            }
+        }
+    }
+    clear();
+}
+
+// 목표 칸 - 성장 아이템, 필요하면 독과 게이트 (날이 지나가는 칸은 뺌)
+void Autopilot::collectTargets(const GameState& state) {
+    targets.clear();
+    state.getItems().forEach([this](int cell, ItemKind kind) {
+        if (danger[cell]) return;
+        if (kind == ITEM_GROW || (kind == ITEM_POISON && wantPoison)) targets.push_back(cell);
+    });
+    if (wantGate) {
+        int a = gateIndex(state.getGateA(), width);
+        int b = gateIndex(state.getGateB(), width);
+        if (a >= 0 && b >= 0) {
+            targets.push_back(a);
+            targets.push_back(b);
+        }
+    }
+}
+
+// 계획 재사용 조건 - 머리가 예상한 칸에 있고, 목표가 그대로이고, 다음 칸이 아직 비어 있음
+// 그 뒤의 칸은 차례가 왔을 때 다시 확인함
+bool Autopilot::planValid(const GameState& state) const {
+    if (plan.empty()) return false;
+    auto head = state.getSerpent().getHeadPosition();
+    if (expectedHead != head.second * width + head.first) return false;
+    if (planTarget >= 0 && state.getMap().atIndex(planTarget) != planTargetCell) return false;
+    if ((planTargetCell == CELL_POISON && !wantPoison) || (planTargetCell == CELL_GATE && !wantGate)) return false;
+
+    const Step& next = plan.back();
+    if (next.gate >= 0) {
+        if (state.getMap().atIndex(next.gate) != CELL_GATE || state.getSerpent().occupiesIndex(next.gate)) return false;
+        Direction exitDir;
+        return gateExit(state, next.gate, next.dir, exitDir) == next.cell;
+    }
+    return !blocked(state, next.cell);
+}
+
+// 새 계획 - 목표까지 안전한 길 -> 꼬리 따라가기 -> 가장 넓은 쪽 순서로 시도
+void Autopilot::replan(const GameState& state) {
+    clear();
+    const Serpent& serpent = state.getSerpent();
+    auto headPos = serpent.getHeadPosition();
+    int head = headPos.second * width + headPos.first;
+    Direction dir = serpent.getCurrentDirection();
+    int closest;
+
+    // 목표까지 - 탐색 한도에 걸리면 목표에 가장 가까워진 칸까지만 가고 다시 계획함
+    collectTargets(state);
+    if (!targets.empty()) {
+        int end = findPath(state, head, dir, -1, closest);
+        bool reached = end >= 0;
+        if (!reached && closest != head) end = closest;
+        if (end >= 0) {
+            buildPlan(state, head, end);
+            if (tailReachable(state)) {
+                if (reached) {
+                    planTarget = plan.front().gate >= 0 ? plan.front().gate : end;
+                    planTargetCell = state.getMap().atIndex(planTarget);
+                }
+                return;
+            }
+            plan.clear();
+        }
+    }
+
+    // 꼬리 따라가기 - 꼬리가 움직이는 동안은 항상 빈 칸이 생기므로 한 칸만 가고 다시 봄
+    if (movingTail >= 0) {
+        targets.assign(1, movingTail);
+        int end = findPath(state, head, dir, movingTail, closest);
+        if (end >= 0) {
+            buildPlan(state, head, end);
+            plan.erase(plan.begin(), plan.end() - 1);
+            return;
+        }
+    }
+
+    // 가장 넓은 쪽으로 한 칸 (같으면 직진)
+    // 갈 곳이 없으면 남는 독이라도 먹고 (길이가 3 이상 남을 때), 그래도 없으면 지금 날이 없는 위험 칸에 들어감
+    int room = min(AUTOPILOT_SEARCH_LIMIT, max(AUTOPILOT_MIN_ROOM, 2 * serpent.length()));
+    int bestRoom = -1;
+    Step choice;
+    for (int pass = 0; pass < 3 && bestRoom < 0; ++pass) {
+        if (pass == 1) wantPoison = serpent.length() > 3;
+        if (pass == 2) riskDanger = true;
+        for (int d = 0; d < 4; ++d) {
+            if (d == opposite[dir]) continue;
+            int next = neighbor(head, d);
+            if (next < 0) continue;
+            Step step = { next, -1, static_cast<Direction>(d) };
+            if (state.getMap().atIndex(next) == CELL_GATE) {
+                if (serpent.occupiesIndex(next)) continue;
+                Direction exitDir;
+                step.gate = next;
+                step.cell = gateExit(state, next, static_cast<Direction>(d), exitDir);
+                if (step.cell < 0 || (danger[step.cell] && !riskDanger)) continue;
+            } else if (blocked(state, next)) {
+                continue;
+            }
+            int count = floodCount(state, step.cell, room);
+            if (count > bestRoom || (count == bestRoom && d == dir)) {
+                bestRoom = count;
+                choice = step;
+            }
+        }
+    }
+    if (bestRoom >= 0) plan.push_back(choice);
+}
+
+// A* - goal이 -1이면 목표 목록(아이템, 게이트 통과) 중 하나, 아니면 goal 칸까지
+// 게이트 칸으로 들어가는 이동은 출구 칸으로 바로 이어지는 간선 하나로 봄
+// 찾으면 도착 칸, 못 찾으면 -1 (closest는 펼친 칸 중 목표에 가장 가까운 칸)
+int Autopilot::findPath(const GameState& state, int start, Direction dir, int goal, int& closest) {
+    nextGeneration();
+    open.clear();
+    finishFrom = -1;
+    seen[start] = generation;
+    cost[start] = 0;
+    link[start] = static_cast<uint8_t>(dir << 2);
+    closest = start;
+    int closestH = heuristic(start);
+    open.push_back({ closestH, 0, start });
+
+    const StageMap& map = state.getMap();
+    int budget = AUTOPILOT_SEARCH_LIMIT;
+    while (!open.empty()) {
+        pop_heap(open.begin(), open.end());
+        OpenNode node = open.back();
+        open.pop_back();
+        int cell = node.cell;
+        if (node.g != cost[cell]) continue;  // 더 짧은 길로 다시 넣은 칸
+        if (cell != start && isGoal(state, cell, goal)) return cell;
+        if (--budget < 0) break;
+        ++expanded;
+
+        Direction heading = linkHeading(link[cell]);
+        for (int d = 0; d < 4; ++d) {
+            if (d == opposite[heading]) continue;
+            int next = neighbor(cell, d);
+            if (next < 0) continue;
+
+            int hop = next;
+            Direction nextDir = static_cast<Direction>(d);
+            uint8_t flags = 0;
+            if (map.atIndex(next) == CELL_GATE) {
+                if (state.getSerpent().occupiesIndex(next)) continue;
+                hop = gateExit(state, next, nextDir, nextDir);
+                if (hop < 0 || danger[hop]) continue;
+                flags = LINK_GATE;
+            } else if (blocked(state, next)) {
+                continue;
+            }
+
+            int g = node.g + 1;
+            uint8_t value = static_cast<uint8_t>(d | (nextDir << 2) | flags);
+            if (flags && goal < 0 && wantGate) {
+                // 게이트 미션 - 통과하는 순간 도착 (출구 칸이 이미 지난 칸일 수 있어 링크는 따로 둠)
+                finishFrom = cell;
+                finishLink = value;
+                return hop;
+            }
+            if (seen[hop] == generation && cost[hop] <= g) continue;
+            seen[hop] = generation;
+            cost[hop] = g;
+            link[hop] = value;
+
+            int h = heuristic(hop);
+            if (h < closestH) {
+                closestH = h;
+                closest = hop;
+            }
+            open.push_back({ g + h, g, hop });
+            push_heap(open.begin(), open.end());
+        }
+    }
+    return -1;
+}
+
+// 도착 칸에서 링크를 거꾸로 따라가며 계획 채움 (plan 앞쪽이 마지막 이동)
+void Autopilot::buildPlan(const GameState& state, int start, int end) {
+    plan.clear();
+    int a = gateIndex(state.getGateA(), width);
+    int b = gateIndex(state.getGateB(), width);
+    int cell = end;
+    bool last = true;
+    while (cell != start || (last && finishFrom >= 0)) {
+        uint8_t value = (last && finishFrom >= 0) ? finishLink : link[cell];
+        last = false;
+        Step step = { cell, -1, linkMove(value) };
+        if (value & LINK_GATE) {
+            int exitGate = neighbor(cell, opposite[linkHeading(value)]);
+            step.gate = exitGate == a ? b : a;
+            cell = neighbor(step.gate, opposite[step.dir]);
+        } else {
+            cell = neighbor(cell, opposite[step.dir]);
+        }
+        plan.push_back(step);
+    }
+}
+
+// 안전 확인 - 계획을 다 간 뒤의 몸통(가상)을 표시하고 새 머리에서 꼬리까지 A*
+// 꼬리에 닿거나 몸 길이의 두 배만큼 넓은 곳이 보이면 안전 (먹은 아이템의 길이 변화 포함)
+bool Autopilot::tailReachable(const GameState& state) {
+    const Serpent& serpent = state.getSerpent();
+    const Step& last = plan.front();
+    Cell eaten = last.gate >= 0 ? CELL_GATE : state.getMap().atIndex(last.cell);
+    int length = serpent.length() + (serpent.growsOnNextMove() ? 1 : 0);
+    if (eaten == CELL_GROW) ++length;
+    else if (eaten == CELL_POISON) --length;
+
+    // 가상 몸통 - 머리부터 계획 칸, 그 뒤로 지금 몸통
+    nextBodyGeneration();
+    int placed = 0;
+    int tail = -1;
+    for (size_t i = 0; i < plan.size() && placed < length; ++i) {
+        bodyMark[plan[i].cell] = bodyGeneration;
+        tail = plan[i].cell;
+        if (++placed < length && plan[i].gate >= 0) {
+            bodyMark[plan[i].gate] = bodyGeneration;
+            tail = plan[i].gate;
+            ++placed;
+        }
+    }
+    for (int i = 0; placed < length && i < serpent.length(); ++i, ++placed) {
+        PackedCell segment = serpent.segmentAt(i);
+        tail = cellY(segment) * width + cellX(segment);
+        bodyMark[tail] = bodyGeneration;
+    }
+
+    // 새 머리에서 가상 꼬리까지 (게이트는 벽으로 봄)
+    int start = last.cell;
+    int room = min(AUTOPILOT_SEARCH_LIMIT, max(AUTOPILOT_MIN_ROOM, 2 * length));
+    targets.assign(1, tail);
+    nextGeneration();
+    open.clear();
+    seen[start] = generation;
+    cost[start] = 0;
+    open.push_back({ heuristic(start), 0, start });
+
+    const StageMap& map = state.getMap();
+    int visited = 0;
+    while (!open.empty()) {
+        pop_heap(open.begin(), open.end());
+        OpenNode node = open.back();
+        open.pop_back();
+        if (node.g != cost[node.cell]) continue;
+        if (++visited >= room) return true;
+        ++expanded;
+
+        for (int d = 0; d < 4; ++d) {
+            int next = neighbor(node.cell, d);
+            if (next < 0) continue;
+            if (next == tail) return true;
+            Cell c = map.atIndex(next);
+            if (c == CELL_WALL || c == CELL_IMMUNE_WALL || c == CELL_GATE || danger[next]) continue;
+            if (c == CELL_POISON && !wantPoison) continue;
+            if (bodyMark[next] == bodyGeneration) continue;
+
+            int g = node.g + 1;
+            if (seen[next] == generation && cost[next] <= g) continue;
+            seen[next] = generation;
+            cost[next] = g;
+            open.push_back({ g + heuristic(next), g, next });
+            push_heap(open.begin(), open.end());
+        }
+    }
+    return false;
+}
+
+// start에서 지금 몸통 기준으로 닿는 칸 수 - cap개를 넘으면 그만 셈
+int Autopilot::floodCount(const GameState& state, int start, int cap) {
+    nextGeneration();
+    queue.clear();
+    queue.push_back(start);
+    seen[start] = generation;
+    for (size_t i = 0; i < queue.size() && static_cast<int>(queue.size()) < cap; ++i) {
+        ++expanded;
+        for (int d = 0; d < 4; ++d) {
+            int next = neighbor(queue[i], d);
+            if (next < 0 || seen[next] == generation || blocked(state, next)) continue;
+            seen[next] = generation;
+            queue.push_back(next);
+        }
+    }
+    return static_cast<int>(queue.size());
+}
+
+// 탐색 도착 조건 - goal이 없으면 먹을 아이템 칸 (게이트는 간선에서 처리)
+bool Autopilot::isGoal(const GameState& state, int cell, int goal) const {
+    if (goal >= 0) return cell == goal;
+    Cell c = state.getMap().atIndex(cell);
+    return (c == CELL_GROW || (c == CELL_POISON && wantPoison)) && !danger[cell];
+}
+
+// 지금 들어가면 죽거나 원치 않는 칸 - 벽, 날이 지나가는 칸, 필요 없는 독, 몸통 (이번에 비는 꼬리는 제외)
+// 게이트 칸은 출구 규칙이 따로 있어 여기서는 막힌 칸으로 봄
+bool Autopilot::blocked(const GameState& state, int cell) const {
+    Cell c = state.getMap().atIndex(cell);
+    if (c == CELL_WALL || c == CELL_IMMUNE_WALL || c == CELL_GATE || (danger[cell] && !riskDanger)) return true;
+    if (c == CELL_POISON && !wantPoison) return true;
+    return state.getSerpent().occupiesIndex(cell) && cell != movingTail;
+}
+
+// 게이트로 들어갔을 때 나올 칸과 방향 - useGate()와 같은 우선순위, 빈 칸이 없으면 -1
+int Autopilot::gateExit(const GameState& state, int gate, Direction entry, Direction& exitDir) const {
+    int a = gateIndex(state.getGateA(), width);
+    int b = gateIndex(state.getGateB(), width);
+    int exitGate = gate == a ? b : (gate == b ? a : -1);
+    if (exitGate < 0) return -1;
+
+    for (Direction d : exitPriorities[entry]) {
+        int cell = neighbor(exitGate, d);
+        if (cell >= 0 && state.getMap().atIndex(cell) == CELL_EMPTY && !state.getSerpent().occupiesIndex(cell)) {
+            exitDir = d;
+            return cell;
+        }
+    }
+    return -1;
+}
+
+// 가장 가까운 목표까지 맨해튼 거리 (목표는 몇 개뿐)
+int Autopilot::heuristic(int cell) const {
+    int x = cell % width, y = cell / width;
+    int best = width + height;
+    for (int target : targets) {
+        int distance = abs(target % width - x) + abs(target / width - y);
+        if (distance < best) best = distance;
+    }
+    return best;
+}
+
+// 이웃 칸 번호 - 맵 밖이면 -1
+int Autopilot::neighbor(int cell, int dir) const {
+    int x = cell % width + stepX[dir];
+    int y = cell / width + stepY[dir];
+    if (x < 0 || x >= width || y < 0 || y >= height) return -1;
+    return y * width + x;
+}
+
+// 세대 번호 증가 - 한 바퀴 돌면 표시를 실제로 지움
+void Autopilot::nextGeneration() {
+    if (++generation == 0) {
+        fill(seen.begin(), seen.end(), 0);
+        generation = 1;
+    }
+}
+
+void Autopilot::nextBodyGeneration() {
+    if (++bodyGeneration == 0) {
+        fill(bodyMark.begin(), bodyMark.end(), 0);
+        bodyGeneration = 1;
+    }
+}
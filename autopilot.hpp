@@ -0,0 +1,92 @@
+#ifndef AUTOPILOT_HPP
+#define AUTOPILOT_HPP
+
+#include "simulation.hpp"
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+const int AUTOPILOT_SEARCH_LIMIT = 4096;  // 탐색 한 번에 펼치는 최대 칸 수 - 맵 넓이와 무관하게 계획 비용을 묶어 둠
+const int AUTOPILOT_MIN_ROOM = 64;        // 꼬리가 안 보여도 이만큼(또는 길이 2배) 넓은 곳이면 안전하다고 봄
+
+// Autopilot 클래스 - 키보드 대신 방향을 정하는 자동 조종기 (소크 테스트와 배치 시뮬레이터의 기준 봇)
+// 필요한 아이템/게이트까지 A*로 길을 찾고, 그 길을 다 간 뒤의 몸통으로 꼬리까지 갈 수 있는지 확인한 뒤 따라감
+// 안전한 길이 없으면 꼬리를 따라가고, 그것도 안 되면 가장 넓은 쪽으로 한 칸 감
+// 게이트는 useGate()와 같은 출구 규칙으로 한 번의 이동으로 보고, 바람개비 날이 지나가는 칸은 벽으로 봄
+// 탐색 버퍼는 칸 수만큼 한 번만 잡고 세대 번호로 지우며, 찾은 길은 막히거나 목표가 사라질 때까지 재사용함
+class Autopilot {
+public:
+    Autopilot(int width, int height);       // 탐색 버퍼 할당 (칸당 약 14바이트)
+
+    // 이번 틱 입력 - 뱀이 움직이지 않는 틱과 방향을 바꾸지 않는 틱은 ACT_NONE
+    Action decide(const GameState& state);
+
+    // 남은 계획 버리기 (새 게임) - 같은 게임에서 머리가 계획과 다르게 움직이면 알아서 다시 계획함
+    void clear();
+
+    long getDecisions() const { return decisions; }  // 뱀이 움직인 틱 수
+    long getReplans() const { return replans; }      // 그중 새로 계획한 수
+    long getExpanded() const { return expanded; }    // 탐색에서 펼친 칸 수 합계
+
+private:
+    // 계획한 이동 한 번
+    struct Step {
+        int cell;        // 이동 뒤 머리 칸 (게이트를 지나면 출구 칸)
+        int gate;        // 지나는 게이트 칸 (없으면 -1)
+        Direction dir;   // 입력 방향
+    };
+
+    // A* 열린 목록 항목 - 힙 맨 위가 f가 가장 작고 (같으면) g가 가장 큰 칸
+    struct OpenNode {
+        int f, g, cell;
+        bool operator<(const OpenNode& other) const {
+            return f != other.f ? f > other.f : g < other.g;
+        }
+    };
+
+    void syncWindmills(const GameState& state);      // 바람개비가 바뀌었으면 위험 칸 다시 표시
+    void collectTargets(const GameState& state);     // 먹을 아이템/지날 게이트 칸 목록
+    bool planValid(const GameState& state) const;    // 남은 계획을 그대로 써도 되는지
+    void replan(const GameState& state);             // 새 계획 세우기
+    int findPath(const GameState& state, int start, Direction dir, int goal, int& closest);  // A* - 도착 칸 (없으면 -1)
+    void buildPlan(const GameState& state, int start, int end);  // findPath() 직후 링크를 따라 계획 채움
+    bool tailReachable(const GameState& state);      // 계획을 다 간 뒤 머리에서 꼬리까지 갈 수 있는지
+    int floodCount(const GameState& state, int start, int cap);  // start에서 닿는 칸 수 (cap까지만 셈)
+    bool isGoal(const GameState& state, int cell, int goal) const;  // 탐색 도착 조건
+    bool blocked(const GameState& state, int cell) const;  // 지금 몸통 기준으로 들어갈 수 없는 칸
+    int gateExit(const GameState& state, int gate, Direction entry, Direction& exitDir) const;  // 게이트 출구 칸 (없으면 -1)
+    int heuristic(int cell) const;                   // 가장 가까운 목표까지 맨해튼 거리
+    int neighbor(int cell, int dir) const;           // 이웃 칸 (맵 밖이면 -1)
+    void nextGeneration();                           // 탐색 표시 지우기
+    void nextBodyGeneration();                       // 가상 몸통 표시 지우기
+
+    int width, height;                       // 맵 크기
+    vector<uint32_t> seen;                   // 칸별 탐색 세대 - generation이 아니면 처음 보는 칸
+    vector<int> cost;                        // 시작 칸부터 이동 수
+    vector<uint8_t> link;                    // 들어온 방법 (입력 방향 | 이동 뒤 방향 << 2 | 게이트 통과)
+    vector<uint32_t> bodyMark;               // 가상 몸통 칸 (bodyGeneration이면 몸통)
+    vector<uint8_t> danger;                  // 바람개비 날이 지나가는 칸
+    uint32_t generation;
+    int finishFrom;                          // 게이트를 지나 도착했으면 게이트 앞 칸 (아니면 -1)
+    uint8_t finishLink;                      // 그때의 마지막 이동 링크
+    uint32_t bodyGeneration;
+    vector<OpenNode> open;                   // A* 열린 목록 (힙)
+    vector<int> queue;                       // 너비 우선 탐색 큐
+    vector<int> targets;                     // 휴리스틱용 목표 칸
+    vector<int> windmillKey;                 // 위험 칸을 표시한 바람개비 (중심 x, y, 날 길이)
+    vector<int> dangerCells;                 // 표시한 위험 칸 (지울 때 씀)
+
+    vector<Step> plan;                       // 남은 이동 - 뒤에서부터 꺼냄
+    int expectedHead;                        // 계획대로 움직였을 때의 머리 칸 (-1이면 계획 없음)
+    int planTarget;                          // 목표 칸 (-1이면 목표 없는 계획)
+    Cell planTargetCell;                     // 목표 칸에 남아 있어야 하는 값
+    int movingTail;                          // 다음 이동에서 비는 꼬리 칸 (성장 대기 중이면 -1)
+    bool wantPoison;                         // 독 미션이 남았고 먹어도 길이가 3 이상
+    bool wantGate;                           // 게이트 미션이 남음
+    bool riskDanger;                         // 마지막 수단 - 날이 지나가는 칸도 지금 비어 있으면 들어감
+
+    long decisions, replans, expanded;
+};
+
+#endif
@@ -0,0 +1,131 @@
+#include "batch.hpp"
+
+// 64비트 섞기 (splitmix64) - 게임/에피소드 번호로 시드를 만듦
+static uint64_t mixSeed(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+// 생성자 - 모든 버퍼를 미리 할당
+BatchSimulator::BatchSimulator(int count, int width, int height, uint64_t baseSeed, int threads, bool observeCells,
+                               const LevelPack* pack)
+    : width(width), height(height), baseSeed(baseSeed), observeCells(observeCells),
+      episodes(count, 0), pool(threads), pendingActions(nullptr), pendingDecisions(nullptr) {
+    buffers.headX.assign(count, 0);
+    buffers.headY.assign(count, 0);
+    buffers.direction.assign(count, 0);
+    buffers.length.assign(count, 0);
+    buffers.stage.assign(count, 0);
+    buffers.reward.assign(count, 0.0f);
+    buffers.done.assign(count, 0);
+    buffers.cleared.assign(count, 0);
+    buffers.episodeTicks.assign(count, 0);
+    if (observeCells) buffers.cells.assign(static_cast<size_t>(count) * width * height, 0);
+
+    states.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        states.emplace_back(width, height, seedFor(i), pack);
+        observe(i);
+    }
+}
+
+// 게임/에피소드별 시드 - 스레드 수와 무관하게 항상 같음
+uint64_t BatchSimulator::seedFor(int i) const {
+    return mixSeed(baseSeed ^ (static_cast<uint64_t>(i) << 32) ^ episodes[i]);
+}
+
+// 전체 게임 한 틱 진행
+void BatchSimulator::step(const Action* actions) {
+    pendingActions = actions;
+    int grain = size() / (pool.size() * 8);
+    if (grain < 16) grain = 16;
+
+    auto body = [this](int begin, int end) { stepRange(begin, end); };
+    pool.parallelFor(size(), grain, body);
+    pendingActions = nullptr;
+}
+
+// 전체 게임의 자동 조종 입력 - 조종기마다 탐색 버퍼가 따로라 게임처럼 나눠 돌림
+void BatchSimulator::autopilotActions(Action* actions) {
+    if (pilots.empty()) {
+        pilots.reserve(states.size());
+        for (size_t i = 0; i < states.size(); ++i) pilots.emplace_back(width, height);
+    }
+
+    pendingDecisions = actions;
+    int grain = size() / (pool.size() * 8);
+    if (grain < 16) grain = 16;
+
+    auto body = [this](int begin, int end) { decideRange(begin, end); };
+    pool.parallelFor(size(), grain, body);
+    pendingDecisions = nullptr;
+}
+
+// [begin, end) 게임의 자동 조종 입력
+void BatchSimulator::decideRange(int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        if (buffers.done[i]) pilots[i].clear();
+        pendingDecisions[i] = pilots[i].decide(states[i]);
+    }
+}
+
+// [begin, end) 게임 진행 - 게임끼리 공유하는 상태가 없어 잠금이 필요 없음
+void BatchSimulator::stepRange(int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        GameState& state = states[i];
+        int stageBefore = state.getStageLevel();
+        int growBefore = state.getGrowScore();
+        int poisonBefore = state.getPoisonScore();
+        int gateBefore = state.getGateScore();
+
+        bool alive = state.step(pendingActions[i]);
+
+        // 점수 변화로 보상 계산 (스테이지가 바뀌면 점수가 초기화됨)
+        float reward = 0.0f;
+        if (state.getStageLevel() != stageBefore || state.isCleared()) {
+            reward += REWARD_STAGE;
+        } else {
+            reward += REWARD_GROW * (state.getGrowScore() - growBefore);
+            reward += REWARD_POISON * (state.getPoisonScore() - poisonBefore);
+            reward += REWARD_GATE * (state.getGateScore() - gateBefore);
+        }
+
+        buffers.done[i] = alive ? 0 : 1;
+        if (!alive) {
+            if (!state.isCleared()) reward += REWARD_DEATH;
+            buffers.cleared[i] = state.isCleared() ? 1 : 0;
+            buffers.episodeTicks[i] = state.getTotalTicks();
+            resetGame(i);
+        }
+        buffers.reward[i] = reward;
+        observe(i);
+    }
+}
+
+// 끝난 게임을 새 시드로 다시 시작 - 할당 재사용
+void BatchSimulator::resetGame(int i) {
+    ++episodes[i];
+    states[i].reset(seedFor(i));
+}
+
+// 관측 기록
+void BatchSimulator::observe(int i) {
+    const GameState& state = states[i];
+    const Serpent& serpent = state.getSerpent();
+    auto head = serpent.getHeadPosition();
+
+    buffers.headX[i] = static_cast<int16_t>(head.first);
+    buffers.headY[i] = static_cast<int16_t>(head.second);
+    buffers.direction[i] = static_cast<uint8_t>(serpent.getCurrentDirection());
+    buffers.length[i] = serpent.length();
+    buffers.stage[i] = static_cast<uint8_t>(state.getStageLevel());
+
+    if (!observeCells) return;
+    uint8_t* cells = buffers.cells.data() + static_cast<size_t>(i) * width * height;
+    const StageMap& map = state.getMap();
+    map.copyRows(0, height, cells);
+    for (auto segment : serpent.getSegments()) cells[segment.second * width + segment.first] = OBS_BODY;
+    cells[head.second * width + head.first] = OBS_HEAD;
+}
@@ -0,0 +1,78 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include "simulation.hpp"
+#include "threadpool.hpp"
+#include "autopilot.hpp"
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// 관측 격자에서 뱀을 나타내는 값 (맵 코드와 겹치지 않는 값)
+const uint8_t OBS_BODY = 3;
+const uint8_t OBS_HEAD = 4;
+
+// 보상 설정
+const float REWARD_GROW = 1.0f;
+const float REWARD_POISON = -1.0f;
+const float REWARD_GATE = 0.5f;
+const float REWARD_STAGE = 5.0f;
+const float REWARD_DEATH = -10.0f;
+
+// BatchBuffers 구조체 - 게임별 관측/보상을 필드별 배열(SoA)로 보관
+// 크기는 생성 시 한 번만 할당하고 매 스텝 덮어씀
+struct BatchBuffers {
+    vector<int16_t> headX, headY;   // 머리 좌표
+    vector<uint8_t> direction;      // 진행 방향 (Direction)
+    vector<int32_t> length;         // 몸통 길이
+    vector<uint8_t> stage;          // 스테이지
+    vector<float> reward;           // 이번 스텝 보상
+    vector<uint8_t> done;           // 이번 스텝에 끝났으면 1 (이미 새 게임으로 리셋됨)
+    vector<uint8_t> cleared;        // 끝난 게임이 전체 클리어였으면 1
+    vector<int32_t> episodeTicks;   // 끝난 게임의 총 틱 수
+    vector<uint8_t> cells;          // 맵 관측 (게임 수 * width * height), 선택 사항
+};
+
+// BatchSimulator 클래스 - N개의 독립 게임을 한 번의 호출로 함께 진행함
+// 끝난 게임은 exit 대신 새 시드로 자동 리셋되고, 결과는 done 플래그로 알림
+class BatchSimulator {
+public:
+    // 생성자 - threads가 0 이하이면 코어 수만큼, pack이 있으면 모든 게임이 같은 레벨 팩을 씀
+    BatchSimulator(int count, int width, int height, uint64_t baseSeed, int threads, bool observeCells,
+                   const LevelPack* pack = nullptr);
+
+    // actions[i]를 i번째 게임에 적용하고 한 틱 진행
+    void step(const Action* actions);
+
+    // 기준 봇 - 게임마다 자동 조종기(Autopilot)를 하나씩 두고 이번 틱 입력을 actions에 채움
+    // 조종기는 처음 부를 때 만들고, 바로 전 step()에서 끝난 게임은 계획을 버리고 새로 시작함
+    void autopilotActions(Action* actions);
+
+    int size() const { return static_cast<int>(states.size()); }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getThreadCount() const { return pool.size(); }
+    const BatchBuffers& getBuffers() const { return buffers; }
+    const GameState& getState(int i) const { return states[i]; }
+
+private:
+    void stepRange(int begin, int end);      // [begin, end) 게임 진행
+    void decideRange(int begin, int end);    // [begin, end) 게임의 자동 조종 입력
+    void resetGame(int i);                   // i번째 게임 새로 시작
+    void observe(int i);                     // i번째 게임 관측 기록
+    uint64_t seedFor(int i) const;           // 게임/에피소드별 시드
+
+    int width, height;
+    uint64_t baseSeed;
+    bool observeCells;
+    vector<GameState> states;
+    vector<uint32_t> episodes;               // 게임별 에피소드 번호
+    BatchBuffers buffers;
+    ThreadPool pool;
+    const Action* pendingActions;            // step() 동안만 유효
+    vector<Autopilot> pilots;                // 게임별 자동 조종기 (autopilotActions()를 쓸 때만)
+    Action* pendingDecisions;                // autopilotActions() 동안만 유효
+};
+
+#endif
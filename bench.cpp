@@ -0,0 +1,540 @@
+#include "benchkit.hpp"
+#include "serpent.hpp"
+#include "simulation.hpp"
+#include "batch.hpp"
+#include "arena.hpp"
+#include "rng.hpp"
+#include "stagegen.hpp"
+#include "autopilot.hpp"
+#include "mcts.hpp"
+#include <deque>
+#include <thread>
+
+// 벤치마크 모음 - make bench가 실행하고 bench.json에 결과를 남김
+// 이름은 "대상/WxH/len:뱀 길이[/추가 값]" 형식이라 릴리스 사이의 결과를 이름으로 맞춰 비교할 수 있음
+
+// 기존 구현 - deque<pair<int,int>> 몸통 + 점유 격자 (Serpent와 비교용)
+class DequeSerpent {
+public:
+    DequeSerpent(int startX, int startY, int width, int height)
+        : width(width), occupancy(width * height, 0), currentDir(RIGHT), pendingGrowth(false) {
+        for (int i = 0; i < 3; ++i) {
+            segments.push_back({ startX - i, startY });
+            ++occupancy[startY * width + startX - i];
+        }
+    }
+    bool setDirection(Direction newDir) { currentDir = newDir; return true; }
+    void extend() { pendingGrowth = true; }
+    int length() const { return static_cast<int>(segments.size()); }
+    const deque<pair<int, int>>& getSegments() const { return segments; }
+    pair<int, int> getHeadPosition() const { return segments.front(); }
+    bool occupies(int x, int y) const { return occupancy[y * width + x] != 0; }
+    void advance() {
+        auto head = segments.front();
+        switch (currentDir) {
+            case UP:    head.second--; break;
+            case DOWN:  head.second++; break;
+            case LEFT:  head.first--;  break;
+            case RIGHT: head.first++;  break;
+        }
+        segments.push_front(head);
+        ++occupancy[head.second * width + head.first];
+        if (!pendingGrowth) {
+            auto tail = segments.back();
+            --occupancy[tail.second * width + tail.first];
+            segments.pop_back();
+        } else {
+            pendingGrowth = false;
+        }
+    }
+
+private:
+    deque<pair<int, int>> segments;
+    int width;
+    vector<uint8_t> occupancy;
+    Direction currentDir;
+    bool pendingGrowth;
+};
+
+static volatile long benchSink;  // 최적화로 루프가 사라지지 않게 함
+
+// 맵 안쪽 전체를 한 바퀴 도는 순환 경로 (안쪽 폭이 짝수일 때)
+// 1행은 왼쪽으로, 홀수 열은 아래로, 짝수 열은 위로 가고 끝에서 오른쪽 열로 넘어감
+static Direction cycleDirection(int x, int y, int width, int height) {
+    if (y == 1) return x == 1 ? DOWN : LEFT;
+    if (x % 2 == 1) return y == height - 2 ? RIGHT : DOWN;
+    if (y == 2) return x == width - 2 ? UP : RIGHT;
+    return UP;
+}
+
+// 안쪽 칸 중 percent%를 차지하는 뱀 길이 (최소 3)
+static int fillLength(int width, int height, int percent) {
+    int length = (width - 2) * (height - 2) * percent / 100;
+    return length < 3 ? 3 : length;
+}
+
+// (3, height - 2)에서 오른쪽을 보고 시작한 몸통을 순환 경로를 따라 length까지 키움
+template <typename Body>
+static void growAlongCycle(Body& body, int length, int width, int height) {
+    while (body.length() < length) {
+        auto head = body.getHeadPosition();
+        body.setDirection(cycleDirection(head.first, head.second, width, height));
+        body.extend();
+        body.advance();
+    }
+}
+
+// 몸통 이동 (순환 경로를 따라 한 칸)
+template <typename Body>
+static void benchAdvance(BenchState& state) {
+    const BenchArgs& a = state.args;
+    Body body(3, a.height - 2, a.width, a.height);
+    growAlongCycle(body, a.length, a.width, a.height);
+    while (state.keepRunning()) {
+        auto head = body.getHeadPosition();
+        body.setDirection(cycleDirection(head.first, head.second, a.width, a.height));
+        body.advance();
+    }
+    benchSink = body.getHeadPosition().first;
+}
+
+// 몸통 전체 순회 (칸당)
+template <typename Body>
+static void benchScan(BenchState& state) {
+    const BenchArgs& a = state.args;
+    Body body(3, a.height - 2, a.width, a.height);
+    growAlongCycle(body, a.length, a.width, a.height);
+    long hits = 0;
+    while (state.keepRunning()) {
+        for (auto segment : body.getSegments()) hits += segment.first ^ segment.second;
+    }
+    state.setItemsPerIteration(body.length());
+    benchSink = hits;
+}
+
+// 무작위 칸 점유 검사
+static void benchOccupies(BenchState& state) {
+    const BenchArgs& a = state.args;
+    Serpent body(3, a.height - 2, a.width, a.height);
+    growAlongCycle(body, a.length, a.width, a.height);
+
+    Rng rng(5);
+    vector<pair<int, int>> queries(4096);
+    for (auto& q : queries) q = { rng.below(a.width), rng.below(a.height) };
+
+    long hits = 0;
+    size_t i = 0;
+    while (state.keepRunning()) {
+        hits += body.occupies(queries[i].first, queries[i].second);
+        i = (i + 1) & (queries.size() - 1);
+    }
+    benchSink = hits;
+}
+
+// 자가 충돌 검사
+static void benchDetectCollision(BenchState& state) {
+    const BenchArgs& a = state.args;
+    Serpent body(3, a.height - 2, a.width, a.height);
+    growAlongCycle(body, a.length, a.width, a.height);
+    long hits = 0;
+    while (state.keepRunning()) hits += body.detectCollision();
+    benchSink = hits;
+}
+
+// SimulationProbe 클래스 - GameState의 내부 단계를 따로 떼어 부르기 위한 friend
+class SimulationProbe {
+public:
+    // 테두리만 있는 맵에 뱀을 순환 경로로 length까지 깔고 아이템/게이트/타이머를 모두 비움
+    static void prepare(GameState& game, int length) {
+        game.items.clear();
+        game.timers.clear(game.totalTicks);
+        game.gateTimer = game.speedTimer = NO_TIMER;
+        game.gateA = game.gateB = { -1, -1 };
+        game.gatesActive = false;
+        game.windmills.clear();
+        game.bladeCells.clear();
+        game.bladeCount.fill(0);
+        game.setupMap();
+
+        game.serpent.reset(3, game.height - 2);
+        growAlongCycle(game.serpent, length, game.width, game.height);
+        game.rebuildCellIndex();
+    }
+
+    // 게이트를 만들지 않게 함 (아이템만 측정)
+    static void disableGates(GameState& game) { game.gatesActive = true; }
+
+    // 종류별 아이템 최대 개수
+    static void setItemCaps(GameState& game, int cap) {
+        for (int k = 0; k < ITEM_KIND_COUNT; ++k) game.itemCaps[k] = cap;
+    }
+
+    static void distributeItems(GameState& game) { game.distributeItems(); }
+
+    // 맵 위 아이템을 모두 치움 (측정 밖 정리용)
+    static void removeItems(GameState& game) {
+        for (int i = 0; i < game.width * game.height; ++i) {
+            Cell cell = game.map.atIndex(i);
+            if (cell == CELL_GROW || cell == CELL_POISON || cell == CELL_BOOST || cell == CELL_SLOW) {
+                game.setCell(i % game.width, i / game.width, CELL_EMPTY);
+            }
+        }
+    }
+
+    // 아이템 수명만큼 시간을 넘기고 만료 타이머를 모두 처리 (기존 cleanUpItems 단계)
+    static void expireItems(GameState& game) {
+        game.totalTicks += ITEM_LIFETIME_TICKS;
+        game.timers.advance(game.totalTicks);
+        TimerEvent event;
+        while (game.timers.popDue(event)) game.fireTimer(event);
+    }
+
+    static void addWindmill(GameState& game, int centerX, int centerY, int length) {
+        game.addWindmill(centerX, centerY, length, WINDMILL_SPIN_TICKS);
+    }
+    static void spinWindmill(GameState& game) { game.spinWindmill(game.windmills[0]); }
+
+    static void useGate(GameState& game, const pair<int, int>& exit) { game.useGate(exit); }
+    static Serpent& serpent(GameState& game) { return game.serpent; }
+    static void rebuildCellIndex(GameState& game) { game.rebuildCellIndex(); }
+};
+
+// 아이템 배치 - 한 번 반복에 distributeItems() 8번 (종류마다 하나씩, 32개)
+static void benchDistributeItems(BenchState& state) {
+    const BenchArgs& a = state.args;
+    const int calls = 8;
+    GameState game(a.width, a.height, 1);
+    SimulationProbe::prepare(game, a.length);
+    SimulationProbe::disableGates(game);
+    SimulationProbe::setItemCaps(game, calls);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < calls; ++i) SimulationProbe::distributeItems(game);
+        state.pauseTiming();
+        SimulationProbe::removeItems(game);
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(calls);
+}
+
+// 아이템 만료 - 32개를 놓은 뒤 수명이 다한 것을 한꺼번에 치움 (아이템당)
+static void benchExpireItems(BenchState& state) {
+    const BenchArgs& a = state.args;
+    const int calls = 8;
+    GameState game(a.width, a.height, 1);
+    SimulationProbe::prepare(game, a.length);
+    SimulationProbe::disableGates(game);
+    SimulationProbe::setItemCaps(game, calls);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        for (int i = 0; i < calls; ++i) SimulationProbe::distributeItems(game);
+        state.resumeTiming();
+        SimulationProbe::expireItems(game);
+    }
+    state.setItemsPerIteration(calls * ITEM_KIND_COUNT);
+}
+
+// 바람개비 한 칸 회전 - 뱀이 닿지 않는 오른쪽에 날 길이 extra인 바람개비 하나
+static void benchSpinWindmill(BenchState& state) {
+    const BenchArgs& a = state.args;
+    GameState game(a.width, a.height, 1);
+    SimulationProbe::prepare(game, a.length);
+    SimulationProbe::addWindmill(game, a.width - a.extra - 3, a.height / 2, a.extra);
+
+    while (state.keepRunning()) SimulationProbe::spinWindmill(game);
+    benchSink = game.isOver();
+}
+
+// 게이트 통과 - 왼쪽 벽 게이트들로 차례로 빠져나감 (통과당)
+// 뱀이 마지막에 지나는 1열을 출구로 쓰므로 90%까지 채워도 출구가 비어 있음
+static void benchUseGate(BenchState& state) {
+    const BenchArgs& a = state.args;
+    const int gates = min(16, a.height - 5);
+    GameState game(a.width, a.height, 1);
+    SimulationProbe::prepare(game, a.length);
+    // 몸통은 스냅샷으로 되돌림 - 복사로 되돌리면 페이지를 공유해 측정 중에 복제가 일어남
+    vector<uint8_t> saved;
+    SimulationProbe::serpent(game).save(saved);
+
+    while (state.keepRunning()) {
+        for (int g = 0; g < gates; ++g) SimulationProbe::useGate(game, { 0, 2 + g });
+        state.pauseTiming();
+        size_t pos = 0;
+        SimulationProbe::serpent(game).load(saved, pos, saved.size());
+        SimulationProbe::rebuildCellIndex(game);
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(gates);
+    benchSink = game.isOver();
+}
+
+// 순환 경로를 따라가는 입력 - 다음 틱에 움직일 때만 방향을 바꿈
+static Action cycleAction(const GameState& game) {
+    static const Action actions[4] = { ACT_UP, ACT_DOWN, ACT_LEFT, ACT_RIGHT };
+    if (!game.movesOnNextStep()) return ACT_NONE;
+    auto head = game.getSerpent().getHeadPosition();
+    Direction dir = cycleDirection(head.first, head.second, game.getWidth(), game.getHeight());
+    return dir != game.getSerpent().getCurrentDirection() ? actions[dir] : ACT_NONE;
+}
+
+// 전체 틱 - 순환 경로를 따라가는 헤드리스 게임 (게임 오버면 측정 밖에서 다시 시작)
+static void benchTick(BenchState& state) {
+    const BenchArgs& a = state.args;
+    uint64_t seed = 1;
+    GameState game(a.width, a.height, seed);
+    SimulationProbe::prepare(game, a.length);
+
+    long restarts = 0;
+    while (state.keepRunning()) {
+        if (!game.step(cycleAction(game))) {
+            state.pauseTiming();
+            game.reset(++seed);
+            SimulationProbe::prepare(game, a.length);
+            ++restarts;
+            state.resumeTiming();
+        }
+    }
+    benchSink = restarts;
+}
+
+// 자동 조종 한 번 (뱀이 움직이는 틱당) - 실제 게임을 진행하되 step()과 움직이지 않는 틱은 측정 밖
+// 라벨은 계획을 새로 세운 비율과 한 번에 펼친 평균 칸 수
+static void benchAutopilot(BenchState& state) {
+    const BenchArgs& a = state.args;
+    uint64_t seed = 1;
+    GameState game(a.width, a.height, seed);
+    Autopilot pilot(a.width, a.height);
+    while (!game.movesOnNextStep()) game.step(ACT_NONE);
+
+    long restarts = 0;
+    while (state.keepRunning()) {
+        Action action = pilot.decide(game);
+        state.pauseTiming();
+        bool alive = game.step(action);
+        while (alive && !game.movesOnNextStep()) alive = game.step(ACT_NONE);
+        if (!alive) {
+            game.reset(++seed);
+            pilot.clear();
+            ++restarts;
+            while (!game.movesOnNextStep()) game.step(ACT_NONE);
+        }
+        state.resumeTiming();
+    }
+    benchSink = restarts;
+
+    char label[64];
+    snprintf(label, sizeof(label), "replan %.1f%%, %.0f cells/replan",
+             100.0 * pilot.getReplans() / max(1L, pilot.getDecisions()),
+             static_cast<double>(pilot.getExpanded()) / max(1L, pilot.getReplans()));
+    state.setLabel(label);
+}
+
+// 트리 탐색 한 번 (롤아웃당 - ops/s가 곧 rollouts/s) - 42x21 실제 게임, extra개 스레드로 기본 설정의 롤아웃
+// step()과 움직이지 않는 틱은 측정 밖, 라벨은 이동 한 번에 노드로 쓴 아레나 크기
+static void benchMcts(BenchState& state) {
+    const BenchArgs& a = state.args;
+    uint64_t seed = 1;
+    GameState game(a.width, a.height, seed);
+    MctsOptions options;
+    options.threads = a.extra;
+    MctsPlayer player(a.width, a.height, options);
+    while (!game.movesOnNextStep()) game.step(ACT_NONE);
+
+    while (state.keepRunning()) {
+        Action action = player.decide(game);
+        state.pauseTiming();
+        bool alive = game.step(action);
+        while (alive && !game.movesOnNextStep()) alive = game.step(ACT_NONE);
+        if (!alive) {
+            game.reset(++seed);
+            player.clear();
+            while (!game.movesOnNextStep()) game.step(ACT_NONE);
+        }
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(options.rollouts);
+    state.setLabel(to_string(player.getNodeBytes()) + " node bytes/move");
+}
+
+// 게임 복사(fork) 후 한 틱 - 뱀이 움직이는 틱이라 바뀐 페이지의 복제까지 포함 (분기당)
+static void benchFork(BenchState& state) {
+    const BenchArgs& a = state.args;
+    GameState base(a.width, a.height, 1);
+    SimulationProbe::prepare(base, a.length);
+    while (!base.movesOnNextStep()) base.step(ACT_NONE);
+    Action action = cycleAction(base);
+
+    long ticks = 0;
+    while (state.keepRunning()) {
+        GameState fork(base);
+        fork.step(action);
+        ticks += fork.getTotalTicks();
+    }
+    benchSink = ticks;
+}
+
+// 스냅샷 저장 (한 번당) - 라벨은 스냅샷 크기
+static void benchSaveSnapshot(BenchState& state) {
+    const BenchArgs& a = state.args;
+    GameState game(a.width, a.height, 1);
+    SimulationProbe::prepare(game, a.length);
+    vector<uint8_t> snapshot;
+
+    while (state.keepRunning()) game.saveSnapshot(snapshot);
+    state.setLabel(to_string(snapshot.size()) + " bytes");
+}
+
+// 스냅샷 복원 (한 번당)
+static void benchLoadSnapshot(BenchState& state) {
+    const BenchArgs& a = state.args;
+    GameState game(a.width, a.height, 1);
+    SimulationProbe::prepare(game, a.length);
+    vector<uint8_t> snapshot;
+    game.saveSnapshot(snapshot);
+
+    bool loaded = true;
+    while (state.keepRunning()) loaded = game.loadSnapshot(snapshot) && loaded;
+    state.setLabel(loaded ? "" : "load failed");
+}
+
+// 배치 시뮬레이션 (게임 스텝당) - 4096게임, extra개 스레드
+static void benchBatch(BenchState& state) {
+    const BenchArgs& a = state.args;
+    const int games = 4096;
+    BatchSimulator batch(games, a.width, a.height, 7, a.extra, false);
+    Rng rng(99);
+    vector<Action> actions(games, ACT_NONE);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        for (int i = 0; i < games; ++i) {
+            actions[i] = (rng.below(16) == 0) ? static_cast<Action>(1 + rng.below(4)) : ACT_NONE;
+        }
+        state.resumeTiming();
+        batch.step(actions.data());
+    }
+    state.setItemsPerIteration(games);
+}
+
+// 배치 시뮬레이션 + 기준 봇 (게임 스텝당) - 4096게임, 입력은 게임마다 Autopilot, 라벨은 끝난 게임 중 클리어 비율
+static void benchBatchAutopilot(BenchState& state) {
+    const BenchArgs& a = state.args;
+    const int games = 4096;
+    BatchSimulator batch(games, a.width, a.height, 7, a.extra, false);
+    vector<Action> actions(games, ACT_NONE);
+
+    long finished = 0, cleared = 0;
+    while (state.keepRunning()) {
+        batch.autopilotActions(actions.data());
+        batch.step(actions.data());
+        state.pauseTiming();
+        for (int i = 0; i < games; ++i) {
+            finished += batch.getBuffers().done[i];
+            cleared += batch.getBuffers().cleared[i] & batch.getBuffers().done[i];
+        }
+        state.resumeTiming();
+    }
+    state.setItemsPerIteration(games);
+
+    char label[64];
+    snprintf(label, sizeof(label), "cleared %ld / %ld", cleared, finished);
+    state.setLabel(label);
+}
+
+// 아레나 한 틱 (뱀 한 마리당) - 256칸마다 뱀 한 마리, extra개 스레드
+// 입력은 가끔 좌/우로만 꺾어 역방향으로 죽지 않게 함
+static void benchArena(BenchState& state) {
+    const BenchArgs& a = state.args;
+    const int snakes = a.width * a.height / 256;
+    Arena arena(a.width, a.height, snakes, 7, a.extra);
+    Rng rng(99);
+    vector<Action> actions(snakes, ACT_NONE);
+    static const Action turns[4][2] = {
+        { ACT_LEFT, ACT_RIGHT }, { ACT_LEFT, ACT_RIGHT }, { ACT_UP, ACT_DOWN }, { ACT_UP, ACT_DOWN }
+    };
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        for (int i = 0; i < snakes; ++i) {
+            actions[i] = (rng.below(8) == 0) ? turns[arena.getSnake(i).dir][rng.below(2)] : ACT_NONE;
+        }
+        state.resumeTiming();
+        arena.step(actions.data());
+    }
+    state.setItemsPerIteration(snakes);
+
+    char label[48];
+    snprintf(label, sizeof(label), "%d snakes, %d alive", snakes, arena.getAliveCount());
+    state.setLabel(label);
+}
+
+// 스테이지 생성 + 검사 (스테이지당)
+static void benchGenerate(BenchState& state) {
+    const BenchArgs& a = state.args;
+    StageGenerator generator(defaultGeneratorOptions(a.width, a.height), 7);
+    StageData stage;
+    long i = 0;
+    while (state.keepRunning()) generator.generate(stage, static_cast<double>(i++ % 10) / 9);
+
+    char label[48];
+    snprintf(label, sizeof(label), "rejected %.1f%%", 100.0 * generator.getRejected() / generator.getAttempts());
+    state.setLabel(label);
+}
+
+// 스레드 수 1, 2, 4, ... 코어 수
+static void threadArgs(Benchmark& bench) {
+    int cores = static_cast<int>(thread::hardware_concurrency());
+    if (cores < 1) cores = 1;
+    for (int threads = 1; threads <= cores; threads *= 2) bench.args(42, 21, 0, threads);
+}
+
+// 아레나 - 작은 맵(64마리)과 큰 맵(1024마리)을 스레드 수별로
+static void arenaArgs(Benchmark& bench) {
+    int cores = static_cast<int>(thread::hardware_concurrency());
+    if (cores < 1) cores = 1;
+    for (int threads = 1; threads <= cores; threads *= 2) {
+        bench.args(128, 128, 0, threads);
+        bench.args(512, 512, 0, threads);
+    }
+}
+
+BENCHMARK(benchAdvance<Serpent>, "serpent/advance")
+    .args(42, 21, 3).args(42, 21, 300).args(400, 400, 800).args(400, 400, 100000);
+BENCHMARK(benchAdvance<DequeSerpent>, "deque/advance")
+    .args(42, 21, 3).args(42, 21, 300).args(400, 400, 800).args(400, 400, 100000);
+BENCHMARK(benchScan<Serpent>, "serpent/scan").args(42, 21, 300).args(400, 400, 800);
+BENCHMARK(benchScan<DequeSerpent>, "deque/scan").args(42, 21, 300).args(400, 400, 800);
+BENCHMARK(benchOccupies, "serpent/occupies").args(42, 21, 3).args(42, 21, 300).args(400, 400, 100000);
+BENCHMARK(benchDetectCollision, "serpent/detectCollision").args(42, 21, 3).args(400, 400, 100000);
+
+BENCHMARK(benchDistributeItems, "game/distributeItems")
+    .args(42, 21, fillLength(42, 21, 0)).args(42, 21, fillLength(42, 21, 50)).args(42, 21, fillLength(42, 21, 90))
+    .args(128, 64, fillLength(128, 64, 0)).args(128, 64, fillLength(128, 64, 50)).args(128, 64, fillLength(128, 64, 90))
+    .args(1000, 1000, 3).args(1000, 1000, 100000);
+BENCHMARK(benchExpireItems, "game/expireItems")
+    .args(42, 21, fillLength(42, 21, 0)).args(42, 21, fillLength(42, 21, 50))
+    .args(128, 64, fillLength(128, 64, 0)).args(128, 64, fillLength(128, 64, 50));
+BENCHMARK(benchSpinWindmill, "game/spinWindmill").extraName("blade")
+    .args(42, 21, 3, 5).args(42, 21, 60, 8).args(128, 64, 3, 20).args(128, 64, 300, 20);
+BENCHMARK(benchUseGate, "game/useGate")
+    .args(42, 21, 3).args(42, 21, fillLength(42, 21, 90)).args(128, 64, 3).args(128, 64, fillLength(128, 64, 90));
+BENCHMARK(benchTick, "game/tick")
+    .args(42, 21, 3).args(42, 21, fillLength(42, 21, 50)).args(128, 64, 3).args(128, 64, fillLength(128, 64, 50))
+    .args(1000, 1000, 3).args(1000, 1000, 100000).args(4000, 4000, 3);
+
+BENCHMARK(benchAutopilot, "autopilot/decide").args(42, 21, 3).args(128, 64, 3).args(1000, 1000, 3);
+
+BENCHMARK(benchFork, "snapshot/fork").args(42, 21, 3).args(42, 21, fillLength(42, 21, 50)).args(1000, 1000, 100000);
+BENCHMARK(benchSaveSnapshot, "snapshot/save").args(42, 21, 3).args(42, 21, fillLength(42, 21, 50)).args(1000, 1000, 100000);
+BENCHMARK(benchLoadSnapshot, "snapshot/load").args(42, 21, 3).args(42, 21, fillLength(42, 21, 50));
+
+BENCHMARK(benchBatch, "batch/step").extraName("threads").apply(threadArgs);
+BENCHMARK(benchBatchAutopilot, "batch/autopilot").extraName("threads").apply(threadArgs);
+BENCHMARK(benchMcts, "mcts/decide").extraName("threads").apply(threadArgs);
+BENCHMARK(benchArena, "arena/step").extraName("threads").apply(arenaArgs);
+BENCHMARK(benchGenerate, "stagegen/generate").args(42, 21, 0).args(128, 64, 0);
+
+int main(int argc, char* argv[]) {
+    return runBenchmarks(argc, argv);
+}
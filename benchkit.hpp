@@ -0,0 +1,229 @@
+#ifndef BENCHKIT_HPP
+#define BENCHKIT_HPP
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+// 작은 마이크로벤치마크 도구 - Google Benchmark와 같은 방식으로 반복 횟수를 늘려 가며
+// 최소 측정 시간을 채운 뒤 ns/op를 보고하고, --json으로 비교용 결과 파일을 남김
+//
+//   static void benchFoo(BenchState& state) {
+//       준비 (측정 안 함)
+//       while (state.keepRunning()) { 측정할 코드 }
+//   }
+//   BENCHMARK(benchFoo, "foo").args(42, 21, 3);
+
+// 벤치마크 인자 - 맵 크기, 뱀 길이, 벤치마크별 추가 값
+struct BenchArgs {
+    int width, height;
+    int length;
+    int extra;
+};
+
+// BenchState 클래스 - 측정 루프 제어
+class BenchState {
+public:
+    BenchState(const BenchArgs& args, long iterations)
+        : args(args), iterations(iterations), done(0), itemsPerIteration(1), pausedNs(0), started(false) {}
+
+    const BenchArgs args;
+
+    // 측정 루프 조건 - 처음 호출될 때 시계를 시작함
+    bool keepRunning() {
+        if (!started) {
+            started = true;
+            start = chrono::steady_clock::now();
+        }
+        if (done < iterations) {
+            ++done;
+            return true;
+        }
+        end = chrono::steady_clock::now();
+        return false;
+    }
+
+    // 반복 사이의 정리 작업을 측정에서 뺌
+    void pauseTiming() { pauseStart = chrono::steady_clock::now(); }
+    void resumeTiming() {
+        pausedNs += chrono::duration<double, nano>(chrono::steady_clock::now() - pauseStart).count();
+    }
+
+    // 한 번 반복에서 처리하는 작업 수 (ns/op 계산용)
+    void setItemsPerIteration(long items) { itemsPerIteration = items; }
+
+    // 결과 레이블 (예: 거부율)
+    void setLabel(const string& text) { label = text; }
+
+    long getIterations() const { return iterations; }
+    long getItemsPerIteration() const { return itemsPerIteration; }
+    const string& getLabel() const { return label; }
+    double elapsedNs() const { return chrono::duration<double, nano>(end - start).count() - pausedNs; }
+
+private:
+    long iterations;
+    long done;
+    long itemsPerIteration;
+    double pausedNs;
+    bool started;
+    string label;
+    chrono::steady_clock::time_point start, end, pauseStart;
+};
+
+typedef void (*BenchFunction)(BenchState&);
+
+// 등록된 벤치마크 하나
+class Benchmark {
+public:
+    Benchmark(BenchFunction function, const char* name) : function(function), name(name) {}
+
+    // 인자 조합 추가 (체이닝)
+    Benchmark& args(int width, int height, int length, int extra = 0) {
+        BenchArgs a = { width, height, length, extra };
+        argList.push_back(a);
+        return *this;
+    }
+
+    // 인자 조합을 함수로 추가 (실행 환경에 따라 달라지는 경우)
+    Benchmark& apply(void (*generator)(Benchmark&)) {
+        generator(*this);
+        return *this;
+    }
+
+    // 추가 값 이름 (결과 이름에 표시, 없으면 생략)
+    Benchmark& extraName(const char* text) {
+        extraLabel = text;
+        return *this;
+    }
+
+    BenchFunction function;
+    string name;
+    string extraLabel;
+    vector<BenchArgs> argList;
+};
+
+// 전역 등록 목록
+inline vector<Benchmark*>& benchmarkRegistry() {
+    static vector<Benchmark*> registry;
+    return registry;
+}
+
+inline Benchmark& registerBenchmark(BenchFunction function, const char* name) {
+    benchmarkRegistry().push_back(new Benchmark(function, name));
+    return *benchmarkRegistry().back();
+}
+
+#define BENCH_CONCAT2(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT2(a, b)
+#define BENCHMARK(function, name) \
+    static Benchmark& BENCH_CONCAT(benchRegistration, __LINE__) = registerBenchmark(function, name)
+
+// 측정 결과 하나
+struct BenchResult {
+    string name;
+    long iterations;
+    double nsPerOp;
+    double opsPerSecond;
+    string label;
+};
+
+// 결과 이름 - "이름/WxH[/len:N][/extra:N]" (뱀 길이 0과 이름 없는 추가 값은 생략)
+inline string benchResultName(const Benchmark& bench, const BenchArgs& a) {
+    char text[160];
+    int n = snprintf(text, sizeof(text), "%s/%dx%d", bench.name.c_str(), a.width, a.height);
+    if (a.length > 0) n += snprintf(text + n, sizeof(text) - n, "/len:%d", a.length);
+    if (!bench.extraLabel.empty()) snprintf(text + n, sizeof(text) - n, "/%s:%d", bench.extraLabel.c_str(), a.extra);
+    return text;
+}
+
+// 한 조합 실행 - 반복 횟수를 10배씩 늘려 minSeconds를 넘기면 그 결과를 씀
+inline BenchResult runBenchmark(const Benchmark& bench, const BenchArgs& a, double minSeconds) {
+    long iterations = 1;
+    while (true) {
+        BenchState state(a, iterations);
+        bench.function(state);
+        double ns = state.elapsedNs();
+        if (ns >= minSeconds * 1e9 || iterations >= 1000000000L) {
+            BenchResult result;
+            result.name = benchResultName(bench, a);
+            result.iterations = iterations;
+            double ops = static_cast<double>(iterations) * state.getItemsPerIteration();
+            result.nsPerOp = ns / ops;
+            result.opsPerSecond = ops / (ns * 1e-9);
+            result.label = state.getLabel();
+            return result;
+        }
+        // 남은 시간을 예측해 한 번에 가깝게 맞춤 (최대 10배)
+        double scale = ns > 0 ? minSeconds * 1e9 * 1.2 / ns : 10.0;
+        if (scale > 10.0) scale = 10.0;
+        if (scale < 2.0) scale = 2.0;
+        iterations = static_cast<long>(iterations * scale);
+    }
+}
+
+// JSON 문자열 (이름/레이블에는 따옴표나 역슬래시가 없음)
+inline void writeBenchJson(FILE* out, const vector<BenchResult>& results) {
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    fprintf(out, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"executable\": \"snake_bench\"\n  },\n", date);
+    fprintf(out, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        fprintf(out, "    {\n      \"name\": \"%s\",\n      \"iterations\": %ld,\n", r.name.c_str(), r.iterations);
+        fprintf(out, "      \"real_time\": %.3f,\n      \"time_unit\": \"ns\",\n", r.nsPerOp);
+        fprintf(out, "      \"items_per_second\": %.1f,\n      \"label\": \"%s\"\n    }%s\n", r.opsPerSecond,
+                r.label.c_str(), i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+// 벤치마크 실행기 - snake_bench [--filter TEXT] [--min-time SEC] [--json FILE]
+inline int runBenchmarks(int argc, char* argv[]) {
+    const char* filter = "";
+    const char* jsonPath = nullptr;
+    double minSeconds = 0.2;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) minSeconds = atof(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--filter TEXT] [--min-time SEC] [--json FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    vector<BenchResult> results;
+    printf("%-48s %14s %14s %12s  %s\n", "benchmark", "ns/op", "ops/s", "iterations", "");
+    for (const Benchmark* bench : benchmarkRegistry()) {
+        for (const BenchArgs& a : bench->argList) {
+            if (benchResultName(*bench, a).find(filter) == string::npos) continue;
+            BenchResult r = runBenchmark(*bench, a, minSeconds);
+            printf("%-48s %14.2f %14.0f %12ld  %s\n", r.name.c_str(), r.nsPerOp, r.opsPerSecond, r.iterations,
+                   r.label.c_str());
+            fflush(stdout);
+            results.push_back(r);
+        }
+    }
+
+    if (jsonPath) {
+        FILE* out = fopen(jsonPath, "w");
+        if (!out) {
+            fprintf(stderr, "cannot write %s\n", jsonPath);
+            return 1;
+        }
+        writeBenchJson(out, results);
+        fclose(out);
+        printf("\nresults: %s\n", jsonPath);
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef BUMPARENA_HPP
+#define BUMPARENA_HPP
+
+#include <vector>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <cstddef>
+
+using namespace std;
+
+// BumpArena 클래스 - 짧게 쓰고 한꺼번에 버리는 객체용 아레나 할당기 (탐색 트리 노드 등)
+// 덩어리(block)를 잡아 두고 앞에서부터 잘라 주기만 하므로 할당은 포인터 덧셈 한 번
+// 개별 해제는 없고 reset()으로 전부 되돌리며, 잡아 둔 덩어리는 해제하지 않고 다음에 다시 씀
+// 소멸자를 부르지 않으므로 소멸자가 할 일이 없는 타입만 만들 수 있음 - 한 스레드에서만 씀
+class BumpArena {
+public:
+    explicit BumpArena(size_t blockSize = 64 * 1024) : blockSize(blockSize), current(0), offset(0), total(0) {}
+
+    BumpArena(const BumpArena&) = delete;
+    BumpArena& operator=(const BumpArena&) = delete;
+
+    // T를 값 초기화해서 만듦
+    template <typename T>
+    T* make() {
+        static_assert(is_trivially_destructible<T>::value, "BumpArena never runs destructors");
+        return new (allocate(sizeof(T), alignof(T))) T();
+    }
+
+    // size바이트 할당 (align은 2의 거듭제곱)
+    void* allocate(size_t size, size_t align) {
+        for (;;) {
+            if (current < blocks.size()) {
+                size_t start = (offset + align - 1) & ~(align - 1);
+                if (start + size <= blockSize) {
+                    offset = start + size;
+                    total += size;
+                    return blocks[current].get() + start;
+                }
+                ++current;
+                offset = 0;
+                continue;
+            }
+            blocks.emplace_back(new char[size > blockSize ? size : blockSize]);
+            if (size > blockSize) {  // 큰 할당은 전용 덩어리 - 다음 할당은 새 덩어리에서
+                blocks.back().swap(blocks[current]);
+                ++current;
+                total += size;
+                return blocks[current - 1].get();
+            }
+        }
+    }
+
+    // 모두 되돌림 - 잡아 둔 덩어리는 그대로 둠
+    void reset() {
+        current = 0;
+        offset = 0;
+        total = 0;
+    }
+
+    size_t used() const { return total; }                       // reset() 이후 할당한 바이트
+    size_t reserved() const { return blocks.size() * blockSize; }  // 잡아 둔 덩어리 크기 (대략)
+
+private:
+    vector<unique_ptr<char[]>> blocks;  // 잡아 둔 덩어리
+    size_t blockSize;                   // 덩어리 하나 크기
+    size_t current;                     // 지금 자르고 있는 덩어리
+    size_t offset;                      // 그 덩어리에서 다음 할당 위치
+    size_t total;                       // reset() 이후 할당한 바이트
+};
+
+#endif
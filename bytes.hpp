@@ -0,0 +1,45 @@
+#ifndef BYTES_HPP
+#define BYTES_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+// 가변 길이 정수 쓰기 (7비트씩, 상위 비트는 이어짐 표시)
+inline void writeVarint(vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+// 가변 길이 정수 읽기 - end 전에 끊기면 false
+inline bool readVarint(const vector<uint8_t>& in, size_t& pos, size_t end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < end; shift += 7) {
+        uint8_t byte = in[pos++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+inline bool readVarint(const vector<uint8_t>& in, size_t& pos, uint64_t& value) {
+    return readVarint(in, pos, in.size(), value);
+}
+
+// 고정 길이 정수 쓰기/읽기 (리틀 엔디언) - 읽을 때 길이 확인은 호출하는 쪽에서
+inline void writeFixed(vector<uint8_t>& out, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+inline uint64_t readFixed(const vector<uint8_t>& in, size_t pos, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; ++i) value |= static_cast<uint64_t>(in[pos + i]) << (8 * i);
+    return value;
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef CELLSET_HPP
+#define CELLSET_HPP
+
+#include "cowarray.hpp"
+#include "bytes.hpp"
+
+using namespace std;
+
+// CellSet 클래스 - 칸 번호 집합 (삽입/삭제/무작위 선택 모두 O(1))
+// dense에 원소를 빽빽하게 두고, position으로 각 칸의 dense 위치를 기억함
+// 두 배열 모두 copy-on-write라 집합 복사는 페이지 포인터만 복사함
+class CellSet {
+public:
+    explicit CellSet(int cellCount = 0) : dense(cellCount, 0), position(cellCount, -1), count(0) {}
+
+    bool contains(int cell) const { return position[cell] >= 0; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    int at(int i) const { return dense[i]; }
+
+    // 칸 추가 - 이미 있으면 무시
+    void insert(int cell) {
+        if (position[cell] >= 0) return;
+        position.write(cell) = count;
+        dense.write(count++) = cell;
+    }
+
+    // 칸 제거 - 마지막 원소를 빈자리로 옮김
+    void erase(int cell) {
+        int pos = position[cell];
+        if (pos < 0) return;
+        int last = dense[--count];
+        dense.write(pos) = last;
+        position.write(last) = pos;
+        position.write(cell) = -1;
+    }
+
+    // 전체 비우기 - 할당은 재사용
+    void clear() {
+        for (int i = 0; i < count; ++i) position.write(dense[i]) = -1;
+        count = 0;
+    }
+
+    // 스냅샷 저장 - 무작위 선택 결과가 같도록 dense 순서 그대로
+    void save(vector<uint8_t>& out) const {
+        writeVarint(out, static_cast<uint64_t>(count));
+        for (int i = 0; i < count; ++i) writeVarint(out, static_cast<uint64_t>(dense[i]));
+    }
+
+    // 스냅샷 복원 - 칸 번호가 범위를 벗어나거나 겹치면 false
+    bool load(const vector<uint8_t>& in, size_t& pos, size_t end) {
+        clear();
+        uint64_t n;
+        if (!readVarint(in, pos, end, n) || n > dense.size()) return false;
+        for (uint64_t i = 0; i < n; ++i) {
+            uint64_t cell;
+            if (!readVarint(in, pos, end, cell) || cell >= dense.size() || contains(static_cast<int>(cell))) return false;
+            insert(static_cast<int>(cell));
+        }
+        return true;
+    }
+
+private:
+    CowArray<int> dense;     // 집합 원소 (앞의 count개)
+    CowArray<int> position;  // 칸 번호 -> dense 위치 (-1이면 없음)
+    int count;               // 원소 수
+};
+
+#endif
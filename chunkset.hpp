@@ -0,0 +1,141 @@
+#ifndef CHUNKSET_HPP
+#define CHUNKSET_HPP
+
+#include "cowarray.hpp"
+#include "bytes.hpp"
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+const int CHUNK_SHIFT = 5;                 // 청크 한 변 32칸
+const int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+
+// ChunkedCellSet 클래스 - 맵을 32x32 청크로 나눠 청크마다 CellSet처럼 칸 번호를 모아 둔 집합
+// 삽입/삭제는 O(1)이고, 무작위 선택은 기준 칸 주변 청크만 보므로 맵 넓이와 무관함
+// 청크 k의 원소는 members의 [k * CHUNK_CELLS, k * CHUNK_CELLS + sizes[k]) 구간에 둠 (copy-on-write)
+class ChunkedCellSet {
+public:
+    static const int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+    explicit ChunkedCellSet(int width = 0, int height = 0)
+        : width(width), chunksX((width + CHUNK_SIZE - 1) >> CHUNK_SHIFT),
+          chunksY((height + CHUNK_SIZE - 1) >> CHUNK_SHIFT), position(width * height, -1),
+          members(static_cast<size_t>(chunksX) * chunksY * CHUNK_CELLS, 0), sizes(chunksX * chunksY, 0), total(0) {}
+
+    bool contains(int cell) const { return position[cell] >= 0; }
+    int size() const { return total; }
+    bool empty() const { return total == 0; }
+
+    // 칸 추가 - 이미 있으면 무시
+    void insert(int cell) {
+        if (position[cell] >= 0) return;
+        int chunk = chunkOf(cell);
+        position.write(cell) = sizes[chunk];
+        members.write(static_cast<size_t>(chunk) * CHUNK_CELLS + sizes[chunk]++) = cell;
+        ++total;
+    }
+
+    // 칸 제거 - 같은 청크의 마지막 원소를 빈자리로 옮김
+    void erase(int cell) {
+        int pos = position[cell];
+        if (pos < 0) return;
+        int chunk = chunkOf(cell);
+        size_t base = static_cast<size_t>(chunk) * CHUNK_CELLS;
+        int last = members[base + --sizes[chunk]];
+        members.write(base + pos) = last;
+        position.write(last) = pos;
+        position.write(cell) = -1;
+        --total;
+    }
+
+    // 전체 비우기 - 할당은 재사용
+    void clear() {
+        for (size_t chunk = 0; chunk < sizes.size(); ++chunk) {
+            for (int i = 0; i < sizes[chunk]; ++i) position.write(members[chunk * CHUNK_CELLS + i]) = -1;
+            sizes[chunk] = 0;
+        }
+        total = 0;
+    }
+
+    // center 칸이 속한 청크에서 radius 청크 안쪽((2r+1)^2 청크)에 있는 원소 수
+    int countNear(int center, int radius) const {
+        int count = 0;
+        forChunksNear(center, radius, [&](int chunk) {
+            count += sizes[chunk];
+            return false;
+        });
+        return count;
+    }
+
+    // 같은 범위에서 k번째 원소 (0 <= k < countNear)
+    int atNear(int center, int radius, int k) const {
+        int cell = -1;
+        forChunksNear(center, radius, [&](int chunk) {
+            int n = sizes[chunk];
+            if (k < n) {
+                cell = members[static_cast<size_t>(chunk) * CHUNK_CELLS + k];
+                return true;
+            }
+            k -= n;
+            return false;
+        });
+        return cell;
+    }
+
+    // 맵 전체를 덮는 반지름
+    int coveringRadius() const { return max(chunksX, chunksY); }
+
+    // 스냅샷 저장 - 청크 순서대로, 청크 안은 저장된 순서 그대로
+    void save(vector<uint8_t>& out) const {
+        writeVarint(out, static_cast<uint64_t>(total));
+        for (size_t chunk = 0; chunk < sizes.size(); ++chunk) {
+            for (int i = 0; i < sizes[chunk]; ++i) writeVarint(out, static_cast<uint64_t>(members[chunk * CHUNK_CELLS + i]));
+        }
+    }
+
+    // 스냅샷 복원 - 청크 순서로 다시 넣으면 청크 안 순서도 같아짐, 칸 번호가 틀리면 false
+    bool load(const vector<uint8_t>& in, size_t& pos, size_t end) {
+        clear();
+        uint64_t n;
+        if (!readVarint(in, pos, end, n) || n > position.size()) return false;
+        int lastChunk = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            uint64_t cell;
+            if (!readVarint(in, pos, end, cell) || cell >= position.size() || contains(static_cast<int>(cell))) return false;
+            int chunk = chunkOf(static_cast<int>(cell));
+            if (chunk < lastChunk) return false;
+            lastChunk = chunk;
+            insert(static_cast<int>(cell));
+        }
+        return true;
+    }
+
+private:
+    int chunkOf(int cell) const {
+        return ((cell / width) >> CHUNK_SHIFT) * chunksX + ((cell % width) >> CHUNK_SHIFT);
+    }
+
+    // 주변 청크를 행 순서로 방문 - visit이 true를 돌려주면 멈춤
+    template <typename Visit>
+    void forChunksNear(int center, int radius, Visit visit) const {
+        int cx = (center % width) >> CHUNK_SHIFT;
+        int cy = (center / width) >> CHUNK_SHIFT;
+        int x0 = max(0, cx - radius), x1 = min(chunksX - 1, cx + radius);
+        int y0 = max(0, cy - radius), y1 = min(chunksY - 1, cy + radius);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                if (visit(y * chunksX + x)) return;
+            }
+        }
+    }
+
+    int width;
+    int chunksX, chunksY;        // 청크 수
+    CowArray<int> position;      // 칸 번호 -> 청크 안 위치 (-1이면 없음)
+    CowArray<int> members;       // 청크별 원소 (청크마다 CHUNK_CELLS칸)
+    vector<int> sizes;           // 청크별 원소 수
+    int total;                   // 전체 원소 수
+};
+
+#endif
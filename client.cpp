@@ -0,0 +1,137 @@
+#include "client.hpp"
+#include <poll.h>
+#include <unistd.h>
+#include <cstdio>
+
+const int CLIENT_POLL_MS = 100;          // 입력/프레임이 없을 때 깨어나는 간격
+const int CLIENT_CONNECT_TIMEOUT_MS = 5000;
+
+RemoteController::RemoteController(const string& address)
+    : address(address), running(true), shownOver(false) {}
+
+// 소멸자 - 화면을 먼저 정리하고 끊긴 이유를 출력
+RemoteController::~RemoteController() {
+    painter.reset();
+    connection.close();
+    if (!closeReason.empty()) fprintf(stderr, "%s\n", closeReason.c_str());
+}
+
+// 메시지 보내기 - 본문이 한 바이트 이하라 프레임을 바로 씀
+void RemoteController::send(MessageType type, uint8_t value) {
+    vector<uint8_t> body(1, value);
+    writeFrame(connection.output, type, body);
+    connection.flush();
+}
+
+void RemoteController::send(MessageType type) {
+    writeFrame(connection.output, type);
+    connection.flush();
+}
+
+// 연결 후 HELLO를 보내고 첫 스냅샷을 기다림
+bool RemoteController::open(string& error) {
+    connection.fd = connectSocket(address, error);
+    if (connection.fd < 0) return false;
+
+    vector<uint8_t> hello = { PROTOCOL_VERSION, 0 };
+    writeFrame(connection.output, MSG_HELLO, hello);
+    if (!connection.flush()) {
+        error = "cannot send hello";
+        return false;
+    }
+
+    pollfd wait = { connection.fd, POLLIN, 0 };
+    bool changed;
+    while (!mirror.hasBoard()) {
+        if (poll(&wait, 1, CLIENT_CONNECT_TIMEOUT_MS) <= 0) {
+            error = "no snapshot from server";
+            return false;
+        }
+        if (!receiveFrames(changed)) {
+            error = closeReason;
+            closeReason.clear();
+            return false;
+        }
+    }
+
+    painter.reset(new BoardPainter(mirror.getWidth(), mirror.getHeight()));
+    painter->draw(mirror);
+    doupdate();
+    return true;
+}
+
+// 받은 프레임을 모두 적용
+bool RemoteController::receiveFrames(bool& changed) {
+    changed = false;
+    if (!connection.receive()) {
+        closeReason = "server closed the connection";
+        return false;
+    }
+
+    MessageType type;
+    size_t begin, end;
+    while (true) {
+        FrameStatus status = readFrame(connection.input, connection.inputPos, type, begin, end);
+        if (status == FRAME_PARTIAL) break;
+        if (status == FRAME_BAD || !mirror.apply(type, connection.input, begin, end)) {
+            closeReason = "bad frame from server";
+            return false;
+        }
+        changed = true;
+    }
+    connection.compactInput();
+    return true;
+}
+
+// 키 입력 - 방향은 그대로 서버로 (방향 전환 큐는 서버가 가짐), q는 종료, r은 게임 오버 후 재시작
+void RemoteController::handleInput() {
+    int ch;
+    while ((ch = getch()) != ERR) {
+        switch (ch) {
+            case 'q':
+                running = false;
+                return;
+            case 'r':
+                if (mirror.isOver()) {
+                    send(MSG_RESTART);
+                    painter->clearResult();
+                    shownOver = false;
+                }
+                break;
+            case KEY_UP:    send(MSG_INPUT, ACT_UP); break;
+            case KEY_DOWN:  send(MSG_INPUT, ACT_DOWN); break;
+            case KEY_LEFT:  send(MSG_INPUT, ACT_LEFT); break;
+            case KEY_RIGHT: send(MSG_INPUT, ACT_RIGHT); break;
+        }
+    }
+}
+
+// 메인 루프 - 소켓과 키보드를 함께 기다리고, 프레임이 오면 그림
+void RemoteController::execute() {
+    while (running) {
+        pollfd waits[2] = {
+            { connection.fd, static_cast<short>(POLLIN | (connection.hasPendingOutput() ? POLLOUT : 0)), 0 },
+            { STDIN_FILENO, POLLIN, 0 }
+        };
+        poll(waits, 2, CLIENT_POLL_MS);
+
+        handleInput();
+        if (!running) break;
+
+        bool changed = false;
+        if ((waits[0].revents & (POLLIN | POLLHUP | POLLERR)) && !receiveFrames(changed)) break;
+        if (connection.hasPendingOutput() && !connection.flush()) {
+            closeReason = "cannot write to server";
+            break;
+        }
+        if (!changed) continue;
+
+        painter->draw(mirror);
+        doupdate();
+        if (mirror.isOver() && !shownOver) {
+            shownOver = true;
+            painter->showResult(mirror.isCleared() ? "CLEAR" : "GAME OVER", gameOverReasonName(mirror.getOverReason()),
+                                "(r: restart, q: quit)");
+        }
+    }
+}
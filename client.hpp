@@ -0,0 +1,40 @@
+#ifndef CLIENT_HPP
+#define CLIENT_HPP
+
+#include "protocol.hpp"
+#include "netio.hpp"
+#include "painter.hpp"
+#include <memory>
+#include <string>
+
+using namespace std;
+
+// RemoteController 클래스 - 서버의 게임을 ncurses 화면에 보여 주는 얇은 클라이언트
+// 키 입력은 바로 서버로 보내고, 받은 프레임을 BoardMirror에 적용해 로컬 게임과 같은 BoardPainter로 그림
+class RemoteController {
+public:
+    explicit RemoteController(const string& address);
+    ~RemoteController();
+
+    // 연결하고 첫 스냅샷까지 기다림 - 실패 시 false와 error
+    bool open(string& error);
+
+    // 메인 루프 - q를 누르거나 연결이 끊기면 반환
+    void execute();
+
+private:
+    bool receiveFrames(bool& changed);       // 받은 프레임 적용 - 끊겼거나 형식이 틀리면 false
+    void handleInput();                      // 키 입력 -> 서버로
+    void send(MessageType type, uint8_t value);
+    void send(MessageType type);
+
+    string address;
+    Connection connection;
+    BoardMirror mirror;                      // 서버 상태 사본
+    unique_ptr<BoardPainter> painter;        // 첫 스냅샷 뒤에 만듦 (그때 맵 크기를 앎)
+    bool running;
+    bool shownOver;                          // 게임 오버 안내를 띄웠는지
+    string closeReason;                      // 연결이 끊긴 이유
+};
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef COWARRAY_HPP
+#define COWARRAY_HPP
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+
+using namespace std;
+
+const int COW_PAGE_SHIFT = 12;                 // 페이지 하나에 4096개
+const int COW_PAGE_SIZE = 1 << COW_PAGE_SHIFT;
+
+// CowArray 클래스 - 페이지 단위로 나눠 복사 시 페이지를 공유하는 고정 크기 배열 (copy-on-write)
+// 복사는 페이지 포인터만 복사하므로 O(페이지 수)이고, 공유 중인 페이지는 처음 쓸 때 한 번 복제함
+// 페이지마다 "혼자 가진 것이 확인됨" 표시를 두어 쓰기는 복사 직후 첫 번째만 참조 수를 확인함
+// 읽기는 간접 참조 한 번이 늘 뿐 분기가 없음 - 쓰기는 write()로만 함
+// 여러 스레드가 같은 원본을 동시에 복사하는 것은 안전함 (한 객체를 동시에 쓰는 것은 안 됨)
+template <typename T>
+class CowArray {
+public:
+    explicit CowArray(size_t count = 0, T value = T()) : count(0), copied(false) { assign(count, value); }
+
+    // 복사 - 양쪽 모두 페이지를 다시 확인해야 함 (원본에는 복사됐다는 표시만 남김)
+    CowArray(const CowArray& other) : keep(other.keep), pages(other.pages), count(other.count), copied(false) {
+        for (Page& page : pages) page.owned = false;
+        other.copied.store(true, memory_order_relaxed);
+    }
+
+    CowArray(CowArray&& other)
+        : keep(std::move(other.keep)), pages(std::move(other.pages)), count(other.count),
+          copied(other.copied.load(memory_order_relaxed)) {}
+
+    CowArray& operator=(const CowArray& other) {
+        if (this == &other) return *this;
+        keep = other.keep;
+        pages = other.pages;
+        count = other.count;
+        for (Page& page : pages) page.owned = false;
+        copied.store(false, memory_order_relaxed);
+        other.copied.store(true, memory_order_relaxed);
+        return *this;
+    }
+
+    CowArray& operator=(CowArray&& other) {
+        keep = std::move(other.keep);
+        pages = std::move(other.pages);
+        count = other.count;
+        copied.store(other.copied.load(memory_order_relaxed), memory_order_relaxed);
+        return *this;
+    }
+
+    size_t size() const { return count; }
+
+    // 읽기
+    const T& operator[](size_t i) const { return pages[i >> COW_PAGE_SHIFT].data[i & (COW_PAGE_SIZE - 1)]; }
+
+    // 쓰기용 참조 - 다른 복사본과 공유 중인 페이지면 먼저 복제함
+    T& write(size_t i) {
+        if (copied.load(memory_order_relaxed)) disown();
+        Page& page = pages[i >> COW_PAGE_SHIFT];
+        if (!page.owned) claim(i >> COW_PAGE_SHIFT);
+        return page.data[i & (COW_PAGE_SIZE - 1)];
+    }
+
+    // 크기를 바꾸고 전체를 value로 채움
+    void assign(size_t newCount, T value) {
+        count = newCount;
+        size_t pageCount = (count + COW_PAGE_SIZE - 1) >> COW_PAGE_SHIFT;
+        keep.assign(pageCount, shared_ptr<T>());
+        pages.assign(pageCount, Page());
+        for (size_t p = 0; p < pageCount; ++p) replace(p);
+        copied.store(false, memory_order_relaxed);
+        fill(value);
+    }
+
+    // 전체를 value로 채움 - 공유 중인 페이지는 복제하지 않고 새로 만듦
+    void fill(T value) {
+        if (copied.load(memory_order_relaxed)) disown();
+        for (size_t p = 0; p < pages.size(); ++p) {
+            if (!pages[p].owned && keep[p].use_count() != 1) replace(p);
+            pages[p].owned = true;
+            std::fill(pages[p].data, pages[p].data + pageLength(p), value);
+        }
+    }
+
+    // [begin, begin + n) 구간을 out으로 복사
+    void copyOut(size_t begin, size_t n, T* out) const {
+        while (n > 0) {
+            size_t p = begin >> COW_PAGE_SHIFT;
+            size_t offset = begin & (COW_PAGE_SIZE - 1);
+            size_t run = min(n, static_cast<size_t>(COW_PAGE_SIZE) - offset);
+            copy(pages[p].data + offset, pages[p].data + offset + run, out);
+            out += run;
+            begin += run;
+            n -= run;
+        }
+    }
+
+    // 다른 복사본과 공유 중인 페이지 수 (벤치마크/점검용)
+    size_t sharedPages() const {
+        size_t shared = 0;
+        for (const shared_ptr<T>& page : keep) shared += page.use_count() != 1;
+        return shared;
+    }
+
+private:
+    struct Page {
+        T* data;     // 페이지 시작 (keep이 소유)
+        bool owned;  // 이 배열만 가진 것이 확인됨 - 바로 써도 됨
+        Page() : data(nullptr), owned(false) {}
+    };
+
+    // 페이지 p에 실제로 쓰이는 원소 수
+    size_t pageLength(size_t p) const {
+        return min(static_cast<size_t>(COW_PAGE_SIZE), count - (p << COW_PAGE_SHIFT));
+    }
+
+    // 새 페이지로 바꿈 (내용은 채우지 않음)
+    void replace(size_t p) {
+        keep[p] = shared_ptr<T>(new T[pageLength(p)], default_delete<T[]>());
+        pages[p].data = keep[p].get();
+        pages[p].owned = true;
+    }
+
+    // 복사된 뒤 처음 쓰는 경우 - 모든 페이지를 다시 확인 대상으로
+    void disown() {
+        copied.store(false, memory_order_relaxed);
+        for (Page& page : pages) page.owned = false;
+    }
+
+    // 페이지 p를 혼자 갖게 함 - 다른 복사본이 남아 있으면 복제
+    void claim(size_t p) {
+        if (keep[p].use_count() != 1) {
+            const T* source = pages[p].data;
+            shared_ptr<T> page(new T[pageLength(p)], default_delete<T[]>());
+            copy(source, source + pageLength(p), page.get());
+            keep[p] = page;
+            pages[p].data = page.get();
+        } else {
+            atomic_thread_fence(memory_order_acquire);  // 다른 스레드가 놓은 복사본의 읽기가 끝난 뒤에 씀
+        }
+        pages[p].owned = true;
+    }
+
+    vector<shared_ptr<T>> keep;  // 페이지 소유 (마지막 페이지만 짧을 수 있음)
+    vector<Page> pages;          // 페이지 주소와 확인 표시
+    size_t count;                // 원소 수
+    mutable atomic<bool> copied; // 마지막 확인 이후 이 배열에서 복사본이 만들어졌는지
+};
+
+#endif
@@ -1,80 +1,66 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
-#include "serpent.hpp"
+#include "simulation.hpp"
+#include "scheduler.hpp"
+#include "input.hpp"
+#include "replay.hpp"
+#include "profiler.hpp"
+#include "painter.hpp"
+#include "autopilot.hpp"
+#include "mcts.hpp"
+#include <string>
+#include <memory>
 #include <ncurses.h>
-#include <vector>
-#include <utility>
-#include <iostream>
-#include <ctime>
 
 using namespace std;
 
-// Windmill 구조체 - 회전 오브젝트를 표현함
-struct Windmill {
-    pair<int, int> center;
-    int length;
-    int state;
-};
+const int MAX_CATCH_UP_STEPS = 8;  // 한 프레임에 따라잡을 최대 틱 수
 
-extern Windmill windmill;  // 외부에서 공유되는 바람개비 정보
+// 실행 옵션 - 시드와 리플레이 기록/재생
+struct SessionOptions {
+    uint64_t seed;           // 첫 게임 시드 - 재시작하면 seed + 게임 번호
+    string recordPath;       // 비어 있지 않으면 이 경로에 리플레이 기록
+    ReplayPlayer* player;    // nullptr가 아니면 키보드 대신 리플레이 재생
+    const LevelPack* pack;   // nullptr가 아니면 이 레벨 팩의 스테이지로 진행
+    string profilePath;      // 비어 있지 않으면 단계별 시간 창을 띄우고 종료 시 이 경로에 저장
+    bool autopilot;          // 키보드 대신 자동 조종기(Autopilot)가 방향을 정함 (q/r은 그대로 받음)
+    bool mcts;               // 키보드 대신 트리 탐색 봇(MctsPlayer)이 방향을 정함
+};
 
+// StageController 클래스 - GameState를 ncurses 화면과 키보드에 연결함
 class StageController {
 public:
-    StageController(int width, int height);  // 생성자
+    StageController(int width, int height, const SessionOptions& options);  // 생성자
     ~StageController();                      // 소멸자
-    void execute();                          // 메인 루프 실행
-    void terminateGame();                    // 게임 종료 처리
+    void execute();                          // 메인 루프 실행 - q를 누르면 반환
+    void terminateGame();                    // 화면 정리 + 통계 출력
 
 private:
+    void finishGame();                       // 게임 오버/재생 끝 처리 (리플레이 저장, 안내 표시)
+    void restartGame();                      // 같은 프로세스에서 새 게임 시작
     void render();                           // 화면 출력
+    void drawProfile();                      // 단계별 시간 창 (1초마다)
     void tick();                             // 상태 갱신
     void handleInput();                      // 키 입력 처리
-    void distributeItems();                  // 아이템 배치
-    void setupMap();                         // 맵 초기화
-    void setupStage();                       // 스테이지 세팅
-    void resetStage();                       // 스테이지 리셋
-    void cleanUpItems();                     // 오래된 아이템 제거
-    void useGate(const pair<int, int>& exit); // 게이트 통과 처리
-    void checkMissions();                    // 미션 진행 상황 갱신
-    void proceedNextStage();                 // 다음 스테이지로 이동
-    void setupWindmill();                    // 바람개비 초기화
-    void spinWindmill();                     // 바람개비 회전 처리
-    bool gateInsideWindmill(const pair<int, int>& gate);  // 게이트가 바람개비 안에 있는지 확인
 
-    // 아이템 관련
-    vector<pair<int, int>> growItems;
-    vector<pair<int, int>> poisonItems;
-    vector<time_t> growItemTimestamps;
-    vector<time_t> poisonItemTimestamps;
-    vector<pair<int, int>> boostItems;
-    vector<pair<int, int>> slowItems;
-    vector<time_t> boostTimestamps;
-    vector<time_t> slowTimestamps;
-
-    Serpent serpent;                         // 뱀 객체
+    GameState state;                         // 게임 규칙/상태
     int width, height;                       // 맵 크기
-    vector<vector<int>> map;                 // 맵 정보
-    pair<int, int> gateA, gateB;             // 게이트 좌표
-    int growScore, poisonScore, gateScore;
-    int maxLength;
-    int stageLevel;
-    int missionLen, missionGrow, missionPoison, missionGate;
-    int missionMaxLen;
-    bool missionLenDone, missionGrowDone, missionPoisonDone, missionGateDone;
-    bool missionMaxDone;
-    bool gatesActive;
-    bool windmillFrozen;
-    time_t pauseStartTime;
-
-    time_t gateTimestamp;
-    time_t gameStartTime;
-    int tickSpeed;
+    BoardPainter painter;                    // 맵/점수판 그리기
+    InputQueue inputQueue;                   // 아직 적용하지 않은 방향 전환
+    unique_ptr<Autopilot> autopilot;         // --autopilot일 때만 (아니면 nullptr)
+    unique_ptr<MctsPlayer> mcts;             // --mcts일 때만 (아니면 nullptr)
+    SessionOptions options;                  // 시드/리플레이 설정
+    ReplayRecorder recorder;                 // 입력 기록기
+    long stepIndex;                          // 지금까지 실행한 step() 수
+    FixedStepScheduler scheduler;            // 고정 간격 틱 스케줄러
+    bool running;                            // 메인 루프 실행 중
+    bool halted;                             // 게임 오버 또는 재생 끝 - 재시작/종료 대기
+    bool terminated;                         // 화면 정리 완료
+    int gameIndex;                           // 이번 실행에서 몇 번째 게임인지
+    long shownProfileSecond;                 // 단계별 시간 창을 마지막으로 그린 초
 
-    WINDOW* mainWin;
-    WINDOW* scoreBoard;
-    WINDOW* missionBoard;
-    WINDOW* timeBoard;
+    WINDOW* profileBoard;                    // --profile일 때만 (아니면 nullptr)
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,55 @@
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include "simulation.hpp"
+
+using namespace std;
+
+const int INPUT_QUEUE_CAPACITY = 4;  // 미리 받아 둘 수 있는 방향 전환 수
+
+// 방향 -> 입력 변환
+inline Action actionFor(Direction dir) {
+    switch (dir) {
+        case UP:    return ACT_UP;
+        case DOWN:  return ACT_DOWN;
+        case LEFT:  return ACT_LEFT;
+        case RIGHT: return ACT_RIGHT;
+    }
+    return ACT_NONE;
+}
+
+// InputQueue 클래스 - 방향 전환 명령을 모아 두는 고정 크기 큐
+// 한 번의 이동에 하나씩 꺼내 쓰고, 남은 명령은 다음 이동으로 넘어감
+class InputQueue {
+public:
+    InputQueue() : head(0), count(0) {}
+
+    // 명령 추가 - 직전 방향과 같은 입력이나 가득 찬 경우는 버림
+    bool push(Direction dir, Direction current) {
+        Direction last = count > 0 ? items[(head + count - 1) % INPUT_QUEUE_CAPACITY] : current;
+        if (dir == last || count == INPUT_QUEUE_CAPACITY) return false;
+        items[(head + count) % INPUT_QUEUE_CAPACITY] = dir;
+        ++count;
+        return true;
+    }
+
+    // 가장 오래된 명령 꺼내기
+    bool pop(Direction& dir) {
+        if (count == 0) return false;
+        dir = items[head];
+        head = (head + 1) % INPUT_QUEUE_CAPACITY;
+        --count;
+        return true;
+    }
+
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+    void clear() { head = 0; count = 0; }
+
+private:
+    Direction items[INPUT_QUEUE_CAPACITY];
+    int head;
+    int count;
+};
+
+#endif
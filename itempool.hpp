@@ -0,0 +1,149 @@
+#ifndef ITEMPOOL_HPP
+#define ITEMPOOL_HPP
+
+#include "timerwheel.hpp"
+#include "cowarray.hpp"
+#include "bytes.hpp"
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// 아이템 종류 - 새 종류는 여기와 simulation.cpp의 itemSpecs/효과 switch에만 추가하면 됨
+enum ItemKind : uint8_t {
+    ITEM_GROW,
+    ITEM_POISON,
+    ITEM_BOOST,
+    ITEM_SLOW,
+    ITEM_KIND_COUNT   // 개수 겸 "아이템 없음"
+};
+
+// ItemPool 클래스 - 모든 아이템을 한 슬롯 배열에 두고 칸 번호로 찾는 풀
+// 슬롯마다 종류와 만료 타이머를 두고, 만료 자체는 TimerWheel이 맡음
+class ItemPool {
+public:
+    explicit ItemPool(int cellCount = 0) : slotAt(cellCount, -1) {
+        fill(live, live + ITEM_KIND_COUNT, 0);
+    }
+
+    // 동시에 놓일 아이템 수만큼 미리 할당
+    void reserve(int count) {
+        slots.reserve(count);
+        freeSlots.reserve(count);
+    }
+
+    // 전체 비우기 - 할당은 재사용
+    void clear() {
+        for (const Item& item : slots) {
+            if (item.cell >= 0) slotAt.write(item.cell) = -1;
+        }
+        slots.clear();
+        freeSlots.clear();
+        fill(live, live + ITEM_KIND_COUNT, 0);
+    }
+
+    // 현재 놓여 있는 종류별 아이템 수
+    int count(ItemKind kind) const { return live[kind]; }
+
+    // 칸에 아이템이 있으면 종류를 돌려줌
+    bool kindAt(int cell, ItemKind& kind) const {
+        int s = slotAt[cell];
+        if (s < 0) return false;
+        kind = slots[s].kind;
+        return true;
+    }
+
+    // 놓여 있는 아이템마다 fn(칸 번호, 종류) 호출 - 슬롯 수(동시에 놓일 최대 개수)에 비례
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (const Item& item : slots) {
+            if (item.cell >= 0) fn(item.cell, item.kind);
+        }
+    }
+
+    // 아이템 추가 - 빈 칸에만 호출함
+    void spawn(ItemKind kind, int cell, TimerId expiry) {
+        int s;
+        if (!freeSlots.empty()) {
+            s = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            s = static_cast<int>(slots.size());
+            slots.push_back(Item());
+        }
+        slots[s].cell = cell;
+        slots[s].kind = kind;
+        slots[s].expiry = expiry;
+        slotAt.write(cell) = s;
+        ++live[kind];
+    }
+
+    // 칸의 아이템 제거 - 취소해야 할 만료 타이머를 돌려줌 (없으면 NO_TIMER)
+    TimerId take(int cell) {
+        int s = slotAt[cell];
+        if (s < 0) return NO_TIMER;
+        Item& item = slots[s];
+        slotAt.write(cell) = -1;
+        --live[item.kind];
+        item.cell = -1;
+        freeSlots.push_back(s);
+        return item.expiry;
+    }
+
+    // 스냅샷 저장 - 슬롯 배열과 빈 슬롯 순서를 그대로 (만료 타이머 번호 포함)
+    void save(vector<uint8_t>& out) const {
+        writeVarint(out, slots.size());
+        for (const Item& item : slots) {
+            writeVarint(out, static_cast<uint64_t>(item.cell + 1));
+            out.push_back(item.kind);
+            writeVarint(out, item.expiry);
+        }
+        writeVarint(out, freeSlots.size());
+        for (int s : freeSlots) writeVarint(out, static_cast<uint64_t>(s));
+    }
+
+    // 스냅샷 복원 - 칸 번호가 틀리거나 슬롯이 겹치면 false
+    bool load(const vector<uint8_t>& in, size_t& pos, size_t end) {
+        clear();
+        uint64_t n;
+        if (!readVarint(in, pos, end, n) || n > slotAt.size()) return false;
+        for (uint64_t s = 0; s < n; ++s) {
+            uint64_t cell, expiry;
+            if (!readVarint(in, pos, end, cell) || cell > slotAt.size() || pos >= end) return false;
+            uint8_t kind = in[pos++];
+            if (kind >= ITEM_KIND_COUNT || !readVarint(in, pos, end, expiry)) return false;
+            Item item;
+            item.cell = static_cast<int>(cell) - 1;
+            item.kind = static_cast<ItemKind>(kind);
+            item.expiry = expiry;
+            if (item.cell >= 0) {
+                if (slotAt[item.cell] >= 0) return false;
+                slotAt.write(item.cell) = static_cast<int>(s);
+                ++live[kind];
+            }
+            slots.push_back(item);
+        }
+        if (!readVarint(in, pos, end, n) || n > slots.size()) return false;
+        for (uint64_t i = 0; i < n; ++i) {
+            uint64_t s;
+            if (!readVarint(in, pos, end, s) || s >= slots.size() || slots[s].cell >= 0) return false;
+            freeSlots.push_back(static_cast<int>(s));
+        }
+        return true;
+    }
+
+private:
+    struct Item {
+        int cell;        // 칸 번호 (-1이면 빈 슬롯)
+        ItemKind kind;
+        TimerId expiry;  // 만료 타이머
+    };
+
+    vector<Item> slots;        // 아이템 슬롯
+    vector<int> freeSlots;     // 재사용 가능한 슬롯
+    CowArray<int> slotAt;      // 칸 번호 -> 슬롯 (-1이면 없음)
+    int live[ITEM_KIND_COUNT]; // 종류별 개수
+};
+
+#endif
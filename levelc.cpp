@@ -0,0 +1,208 @@
+#include "levelpack.hpp"
+#include "stagegen.hpp"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+// 레벨 팩 컴파일러 - 텍스트 스테이지 정의를 레벨 팩(.pack)으로 변환함
+//
+// 텍스트 형식 (# 뒤는 주석, stage ... end가 스테이지 하나)
+//   stage
+//   spawn X Y right|left|up|down        (기본: 가운데, right)
+//   mission len N maxlen N grow N poison N gate N
+//   items grow N poison N boost N slow N
+//   windmill X Y LENGTH SPIN_TICKS      (여러 개 가능)
+//   map
+//   *####*      * 모서리 벽, # 벽, . 또는 공백은 빈 칸
+//   #....#
+//   *####*
+//   end
+//
+// 생성 모드: levelc --generate COUNT WIDTHxHEIGHT SEED OUTPUT.pack
+//   StageGenerator로 난이도 순 스테이지 COUNT개를 만들어 바로 기록함
+
+// 오류 출력
+static bool error(const string& file, int line, const string& message) {
+    fprintf(stderr, "%s:%d: %s\n", file.c_str(), line, message.c_str());
+    return false;
+}
+
+// 방향 이름 -> Direction 값 (UP, DOWN, LEFT, RIGHT 순)
+static int parseDirection(const string& name) {
+    if (name == "up") return 0;
+    if (name == "down") return 1;
+    if (name == "left") return 2;
+    if (name == "right") return 3;
+    return -1;
+}
+
+// "key value key value ..." 형식 읽기
+static bool parsePairs(istringstream& in, const char* const* keys, int keyCount, int* values) {
+    string key;
+    int value;
+    while (in >> key >> value) {
+        int k = 0;
+        while (k < keyCount && key != keys[k]) ++k;
+        if (k == keyCount || value < 0 || value > 0xFFFF) return false;
+        values[k] = value;
+    }
+    return in.eof();
+}
+
+// 스테이지 검사 - 바람개비가 맵 안쪽 빈 칸에서만 도는지, 그리고 StageValidator로 끝까지 플레이 가능한지 (벽 테두리 포함)
+static bool validate(StageValidator& validator, const StageData& stage, const string& file, int line) {
+    for (const WindmillSpec& spec : stage.windmills) {
+        if (!windmillFits(spec, stage.cells.data(), stage.width, stage.height)) {
+            return error(file, line, "windmill must sweep only empty cells inside the map");
+        }
+    }
+    const char* reason = nullptr;
+    if (!validator.validate(stage, reason)) return error(file, line, reason);
+    return true;
+}
+
+// 텍스트 파일 하나 읽기
+static bool parseFile(const string& path, StageValidator& validator, vector<StageData>& stages) {
+    static const char* const missionKeys[] = { "len", "maxlen", "grow", "poison", "gate" };
+    static const char* const itemKeys[] = { "grow", "poison", "boost", "slow" };
+
+    ifstream in(path.c_str());
+    if (!in) return error(path, 0, "cannot open");
+
+    string text;
+    int lineNo = 0, stageLine = 0;
+    bool inStage = false, inMap = false;
+    bool spawnSet = false;
+    StageData stage;
+
+    while (getline(in, text)) {
+        ++lineNo;
+        if (!text.empty() && text[text.size() - 1] == '\r') text.erase(text.size() - 1);
+
+        if (inMap) {
+            if (text == "end") {
+                inMap = inStage = false;
+                if (stage.cells.empty()) return error(path, lineNo, "empty map");
+                stage.height = static_cast<int>(stage.cells.size()) / stage.width;
+                if (!spawnSet) {
+                    stage.spawnX = stage.width / 2;
+                    stage.spawnY = stage.height / 2;
+                }
+                if (!validate(validator, stage, path, stageLine)) return false;
+                stages.push_back(stage);
+                continue;
+            }
+            if (stage.cells.empty()) stage.width = static_cast<int>(text.size());
+            if (static_cast<int>(text.size()) != stage.width) return error(path, lineNo, "map rows must have the same width");
+            for (char c : text) {
+                if (c == '*') stage.cells.push_back(2);
+                else if (c == '#') stage.cells.push_back(1);
+                else if (c == '.' || c == ' ') stage.cells.push_back(0);
+                else return error(path, lineNo, string("unknown map cell '") + c + "'");
+            }
+            continue;
+        }
+
+        size_t hash = text.find('#');
+        if (hash != string::npos) text.erase(hash);
+        istringstream line(text);
+        string word;
+        if (!(line >> word)) continue;
+
+        if (word == "stage") {
+            if (inStage) return error(path, lineNo, "missing end");
+            inStage = true;
+            stageLine = lineNo;
+            spawnSet = false;
+            initStageData(stage, 0, 0);
+        } else if (!inStage) {
+            return error(path, lineNo, "expected stage");
+        } else if (word == "spawn") {
+            string dir;
+            if (!(line >> stage.spawnX >> stage.spawnY >> dir) || (stage.spawnDir = parseDirection(dir)) < 0) {
+                return error(path, lineNo, "usage: spawn X Y right|left|up|down");
+            }
+            spawnSet = true;
+        } else if (word == "mission") {
+            if (!parsePairs(line, missionKeys, 5, stage.mission)) return error(path, lineNo, "bad mission");
+        } else if (word == "items") {
+            if (!parsePairs(line, itemKeys, LEVEL_ITEM_KINDS, stage.caps)) return error(path, lineNo, "bad item caps");
+        } else if (word == "windmill") {
+            WindmillSpec spec;
+            if (!(line >> spec.centerX >> spec.centerY >> spec.length >> spec.spinTicks)) {
+                return error(path, lineNo, "usage: windmill X Y LENGTH SPIN_TICKS");
+            }
+            if (stage.windmills.size() == 255) return error(path, lineNo, "too many windmills");
+            stage.windmills.push_back(spec);
+        } else if (word == "map") {
+            inMap = true;
+        } else {
+            return error(path, lineNo, "unknown keyword " + word);
+        }
+    }
+    if (inStage) return error(path, lineNo, "missing end");
+    return true;
+}
+
+// 생성 모드
+static int generate(int argc, char* argv[]) {
+    int count = 0, width = 0, height = 0;
+    if (argc != 6 || (count = atoi(argv[2])) < 1 || sscanf(argv[3], "%dx%d", &width, &height) != 2 ||
+        width < 10 || height < 8 || width > 0xFFFF || height > 0xFFFF) {
+        fprintf(stderr, "usage: %s --generate COUNT WIDTHxHEIGHT SEED OUTPUT.pack\n", argv[0]);
+        return 1;
+    }
+
+    StageGenerator generator(defaultGeneratorOptions(width, height), strtoull(argv[4], nullptr, 10));
+    vector<StageData> stages;
+    generator.generateCurriculum(count, stages);
+    if (!saveLevelPack(argv[5], stages)) {
+        fprintf(stderr, "cannot write %s\n", argv[5]);
+        return 1;
+    }
+    printf("%s: %d stages (%ld attempts, %ld rejected)\n", argv[5], count, generator.getAttempts(),
+           generator.getRejected());
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--generate") == 0) return generate(argc, argv);
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s OUTPUT.pack INPUT.txt...\n"
+                        "       %s --generate COUNT WIDTHxHEIGHT SEED OUTPUT.pack\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    StageValidator validator;
+    vector<StageData> stages;
+    for (int i = 2; i < argc; ++i) {
+        if (!parseFile(argv[i], validator, stages)) return 1;
+    }
+    if (stages.empty()) {
+        fprintf(stderr, "no stages\n");
+        return 1;
+    }
+    for (const StageData& stage : stages) {
+        if (stage.width != stages[0].width || stage.height != stages[0].height) {
+            fprintf(stderr, "all stages must be %dx%d\n", stages[0].width, stages[0].height);
+            return 1;
+        }
+    }
+
+    vector<uint8_t> out;
+    encodeLevelPack(stages, out);
+
+    FILE* file = fopen(argv[1], "wb");
+    if (!file || fwrite(out.data(), 1, out.size(), file) != out.size()) {
+        fprintf(stderr, "cannot write %s\n", argv[1]);
+        if (file) fclose(file);
+        return 1;
+    }
+    fclose(file);
+    printf("%s: %zu stages, %zu bytes\n", argv[1], stages.size(), out.size());
+    return 0;
+}
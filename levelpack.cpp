@@ -0,0 +1,217 @@
+#include "levelpack.hpp"
+#include <cstring>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 생성자
+LevelPack::LevelPack() : data(nullptr), length(0), mapped(false), stageCount(0), width(0), height(0) {}
+
+// 소멸자
+LevelPack::~LevelPack() {
+    close();
+}
+
+// 매핑 해제
+void LevelPack::close() {
+    if (data && mapped) munmap(const_cast<uint8_t*>(data), length);
+    data = nullptr;
+    length = 0;
+    mapped = false;
+    owned.clear();
+    stageCount = 0;
+    width = height = 0;
+}
+
+// 오류 기록
+bool LevelPack::fail(const string& message) {
+    close();
+    error = message;
+    return false;
+}
+
+// 파일 열기 - 모든 스테이지의 칸을 한 번씩 검사하므로 비용은 전체 칸 수에 비례함 (O(스테이지 수 × 넓이))
+bool LevelPack::open(const string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return fail("cannot open " + path);
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(LEVEL_PACK_HEADER)) {
+        ::close(fd);
+        return fail("not a level pack: " + path);
+    }
+
+    length = static_cast<size_t>(info.st_size);
+    void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        length = 0;
+        return fail("cannot map " + path);
+    }
+    data = static_cast<const uint8_t*>(view);
+    mapped = true;
+    return validate(path);
+}
+
+// 메모리 팩 열기
+bool LevelPack::openBuffer(vector<uint8_t> bytes) {
+    close();
+    owned.swap(bytes);
+    data = owned.data();
+    length = owned.size();
+    if (length < LEVEL_PACK_HEADER) return fail("not a level pack: <memory>");
+    return validate("<memory>");
+}
+
+// 스테이지 표와 각 스테이지 머리/칸 검사 - 손으로 만들었거나 깨진 팩이 GameState에 닿지 않게 함
+bool LevelPack::validate(const string& path) {
+    if (memcmp(data, "SNKL", 4) != 0 || data[4] != LEVEL_PACK_VERSION) return fail("not a level pack: " + path);
+
+    uint32_t count = loadU32(data + 8);
+    if (count == 0 || (length - LEVEL_PACK_HEADER) / 4 < count) return fail("bad stage table: " + path);
+
+    // 각 스테이지가 파일 안에 있고 크기/시작 위치/바람개비가 올바른지
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t offset = loadU32(data + LEVEL_PACK_HEADER + 4 * i);
+        if (offset > length || length - offset < LEVEL_STAGE_HEADER) return fail("bad stage offset: " + path);
+
+        StageView view(data + offset);
+        if (length - offset < view.byteSize()) return fail("truncated stage: " + path);
+
+        int w = view.getWidth(), h = view.getHeight();
+        if (i == 0) {
+            width = w;
+            height = h;
+        }
+        if (w < 5 || h < 5 || w != width || h != height) return fail("stage sizes differ: " + path);
+        const uint8_t* cells = view.getCells();
+        for (size_t c = 0, n = static_cast<size_t>(w) * h; c < n; ++c) {
+            if (cells[c] > 2) return fail("bad cell: " + path);
+        }
+        if (!borderIsWall(cells, w, h)) return fail("open border: " + path);
+        if (view.getSpawnDir() > 3 || !spawnFits(cells, w, h, view.getSpawnX(), view.getSpawnY(), view.getSpawnDir())) {
+            return fail("bad spawn: " + path);
+        }
+
+        for (int k = 0; k < view.getWindmillCount(); ++k) {
+            if (!windmillFits(view.getWindmill(k), cells, w, h)) return fail("bad windmill: " + path);
+        }
+    }
+
+    stageCount = static_cast<int>(count);
+    error.clear();
+    return true;
+}
+
+// 테두리 검사
+bool borderIsWall(const uint8_t* cells, int width, int height) {
+    for (int x = 0; x < width; ++x) {
+        if (cells[x] == 0 || cells[(height - 1) * width + x] == 0) return false;
+    }
+    for (int y = 0; y < height; ++y) {
+        if (cells[y * width] == 0 || cells[y * width + width - 1] == 0) return false;
+    }
+    return true;
+}
+
+// 뱀 시작 칸 검사 - Serpent::reset()과 같은 순서로 머리 뒤 두 칸까지
+bool spawnFits(const uint8_t* cells, int width, int height, int spawnX, int spawnY, int spawnDir) {
+    int dx = spawnDir == 3 ? 1 : spawnDir == 2 ? -1 : 0;
+    int dy = spawnDir == 1 ? 1 : spawnDir == 0 ? -1 : 0;
+    for (int i = 0; i < 3; ++i) {
+        int x = spawnX - i * dx, y = spawnY - i * dy;
+        if (x < 1 || y < 1 || x >= width - 1 || y >= height - 1 || cells[y * width + x] != 0) return false;
+    }
+    return true;
+}
+
+// 바람개비 검사 - 날이 닿는 칸은 GameState::addWindmill()처럼 맵 안쪽을 벗어나기 전까지
+bool windmillFits(const WindmillSpec& spec, const uint8_t* cells, int width, int height) {
+    static const int sweepX[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+    static const int sweepY[8] = { -1, -1, 0, 1, 1, 1, 0, -1 };
+
+    if (spec.centerX < 1 || spec.centerY < 1 || spec.centerX >= width - 1 || spec.centerY >= height - 1 ||
+        spec.length < 1 || spec.length > (width > height ? width : height) || spec.spinTicks < 1) {
+        return false;
+    }
+    for (int d = 0; d < 8; ++d) {
+        for (int i = 1; i <= spec.length; ++i) {
+            int x = spec.centerX + sweepX[d] * i, y = spec.centerY + sweepY[d] * i;
+            if (x < 1 || y < 1 || x >= width - 1 || y >= height - 1) break;
+            if (cells[y * width + x] != 0) return false;
+        }
+    }
+    return true;
+}
+
+// 기본 미션/아이템 개수
+void initStageData(StageData& stage, int width, int height) {
+    static const int mission[5] = { 4, 5, 1, 1, 1 };
+    static const int caps[LEVEL_ITEM_KINDS] = { 3, 3, 1, 1 };
+
+    stage.width = width;
+    stage.height = height;
+    stage.spawnX = width / 2;
+    stage.spawnY = height / 2;
+    stage.spawnDir = 3;  // RIGHT
+    memcpy(stage.mission, mission, sizeof(mission));
+    memcpy(stage.caps, caps, sizeof(caps));
+    stage.windmills.clear();
+    stage.cells.assign(static_cast<size_t>(width) * height, 0);
+}
+
+static void putU16(vector<uint8_t>& out, int value) {
+    out.push_back(static_cast<uint8_t>(value & 0xFF));
+    out.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+}
+
+static void putU32(vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>((value >> (8 * i)) & 0xFF));
+}
+
+// 레벨 팩 인코딩
+void encodeLevelPack(const vector<StageData>& stages, vector<uint8_t>& out) {
+    out.insert(out.end(), { 'S', 'N', 'K', 'L', LEVEL_PACK_VERSION, 0, 0, 0 });
+    putU32(out, static_cast<uint32_t>(stages.size()));
+    size_t table = out.size();
+    out.resize(out.size() + 4 * stages.size());
+
+    for (size_t i = 0; i < stages.size(); ++i) {
+        const StageData& stage = stages[i];
+        uint32_t offset = static_cast<uint32_t>(out.size());
+        for (int b = 0; b < 4; ++b) out[table + 4 * i + b] = static_cast<uint8_t>((offset >> (8 * b)) & 0xFF);
+
+        putU16(out, stage.width);
+        putU16(out, stage.height);
+        putU16(out, stage.spawnX);
+        putU16(out, stage.spawnY);
+        out.push_back(static_cast<uint8_t>(stage.spawnDir));
+        out.push_back(static_cast<uint8_t>(stage.windmills.size()));
+        for (int k = 0; k < 5; ++k) putU16(out, stage.mission[k]);
+        for (int k = 0; k < LEVEL_ITEM_KINDS; ++k) putU16(out, stage.caps[k]);
+        putU32(out, 0);
+
+        for (const WindmillSpec& spec : stage.windmills) {
+            putU16(out, spec.centerX);
+            putU16(out, spec.centerY);
+            putU16(out, spec.length);
+            putU16(out, spec.spinTicks);
+        }
+        out.insert(out.end(), stage.cells.begin(), stage.cells.end());
+    }
+}
+
+// 파일로 저장
+bool saveLevelPack(const string& path, const vector<StageData>& stages) {
+    vector<uint8_t> out;
+    encodeLevelPack(stages, out);
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) return false;
+    bool ok = fwrite(out.data(), 1, out.size(), file) == out.size();
+    return fclose(file) == 0 && ok;
+}
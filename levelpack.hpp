@@ -0,0 +1,146 @@
+#ifndef LEVELPACK_HPP
+#define LEVELPACK_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+// 레벨 팩 파일 형식 (리틀 엔디언)
+//   "SNKL" | 버전(u8) | 예약(3) | 스테이지 수(u32) | 스테이지 위치(u32 × 스테이지 수)
+//   스테이지: 고정 머리(32바이트) | 바람개비(8바이트 × 개수) | 칸(width × height, 행 단위)
+//     머리: width, height, spawnX, spawnY (u16) | spawnDir(u8) | 바람개비 수(u8)
+//           미션 len, maxLen, grow, poison, gate (u16) | 아이템 최대 개수 4종(u16) | 예약(u32)
+//     바람개비: centerX, centerY, length, spinTicks (u16)
+//     칸: 0 빈 칸, 1 벽, 2 모서리 벽
+const uint8_t LEVEL_PACK_VERSION = 1;
+const size_t LEVEL_PACK_HEADER = 12;
+const size_t LEVEL_STAGE_HEADER = 32;
+const size_t LEVEL_WINDMILL_SIZE = 8;
+const int LEVEL_ITEM_KINDS = 4;  // 성장, 독, 속도 증가, 속도 감소 순
+
+// 리틀 엔디언 읽기 - 정렬되지 않은 위치에서도 안전함
+inline uint16_t loadU16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+inline uint32_t loadU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// 바람개비 배치
+struct WindmillSpec {
+    int centerX, centerY;
+    int length;
+    int spinTicks;
+};
+
+// StageData 구조체 - 스테이지 하나의 내용 (컴파일러/생성기가 채우고 encodeLevelPack으로 기록)
+struct StageData {
+    int width, height;
+    int spawnX, spawnY, spawnDir;      // spawnDir은 Direction 값
+    int mission[5];                    // len, maxLen, grow, poison, gate
+    int caps[LEVEL_ITEM_KINDS];
+    vector<WindmillSpec> windmills;
+    vector<uint8_t> cells;             // 0 빈 칸, 1 벽, 2 모서리 벽
+};
+
+// 테두리 칸이 모두 벽(1, 2)인지 - 아니면 뱀이 맵 밖으로 나갈 수 있음
+bool borderIsWall(const uint8_t* cells, int width, int height);
+
+// 뱀 시작 세 칸(머리와 spawnDir 반대쪽 두 칸)이 맵 안쪽 빈 칸인지
+bool spawnFits(const uint8_t* cells, int width, int height, int spawnX, int spawnY, int spawnDir);
+
+// 바람개비 중심이 맵 안쪽이고 날 길이(1 ~ 맵의 긴 변)와 회전 주기(1틱 이상)가 올바르며,
+// 날이 도는 칸(8방향 length칸, 맵 안쪽까지)이 모두 빈 칸인지 - 날은 지나간 칸을 빈 칸으로 되돌리므로 벽을 지움
+bool windmillFits(const WindmillSpec& spec, const uint8_t* cells, int width, int height);
+
+// 기본 미션/아이템 개수로 초기화 (기본 스테이지 1과 같음)
+void initStageData(StageData& stage, int width, int height);
+
+// 스테이지 목록을 레벨 팩 바이트로 인코딩
+void encodeLevelPack(const vector<StageData>& stages, vector<uint8_t>& out);
+
+// 레벨 팩 파일로 저장 - 실패 시 false
+bool saveLevelPack(const string& path, const vector<StageData>& stages);
+
+// StageView 클래스 - 팩 안의 스테이지 하나를 복사 없이 가리키는 뷰
+class StageView {
+public:
+    explicit StageView(const uint8_t* record = nullptr) : record(record) {}
+
+    int getWidth() const { return loadU16(record); }
+    int getHeight() const { return loadU16(record + 2); }
+    int getSpawnX() const { return loadU16(record + 4); }
+    int getSpawnY() const { return loadU16(record + 6); }
+    int getSpawnDir() const { return record[8]; }  // Direction 값
+    int getWindmillCount() const { return record[9]; }
+    int getMissionLen() const { return loadU16(record + 10); }
+    int getMissionMaxLen() const { return loadU16(record + 12); }
+    int getMissionGrow() const { return loadU16(record + 14); }
+    int getMissionPoison() const { return loadU16(record + 16); }
+    int getMissionGate() const { return loadU16(record + 18); }
+    int getItemCap(int kind) const { return loadU16(record + 20 + 2 * kind); }
+
+    WindmillSpec getWindmill(int i) const {
+        const uint8_t* p = record + LEVEL_STAGE_HEADER + LEVEL_WINDMILL_SIZE * i;
+        WindmillSpec spec = { loadU16(p), loadU16(p + 2), loadU16(p + 4), loadU16(p + 6) };
+        return spec;
+    }
+
+    // 칸 정보 (y * width + x)
+    const uint8_t* getCells() const {
+        return record + LEVEL_STAGE_HEADER + LEVEL_WINDMILL_SIZE * getWindmillCount();
+    }
+
+    // 스테이지 전체 크기 (바이트)
+    size_t byteSize() const {
+        return LEVEL_STAGE_HEADER + LEVEL_WINDMILL_SIZE * getWindmillCount() +
+               static_cast<size_t>(getWidth()) * getHeight();
+    }
+
+private:
+    const uint8_t* record;
+};
+
+// LevelPack 클래스 - 레벨 팩 파일을 mmap으로 열어 스테이지를 바로 꺼내 씀
+// 열 때 머리, 칸 값, 벽 테두리, 뱀 시작 칸, 바람개비가 도는 칸을 검사함 (빈 칸이 모두 이어지는지 같은 플레이 가능성 검사는 levelc의 몫)
+// 생성기가 메모리에서 만든 팩은 openBuffer()로 파일 없이 씀
+class LevelPack {
+public:
+    LevelPack();
+    ~LevelPack();
+
+    LevelPack(const LevelPack&) = delete;
+    LevelPack& operator=(const LevelPack&) = delete;
+
+    // 파일 열기 - 형식이 맞지 않으면 false, 이유는 getError()
+    bool open(const string& path);
+
+    // 메모리의 팩 바이트를 넘겨받아 열기
+    bool openBuffer(vector<uint8_t> bytes);
+
+    void close();
+
+    int size() const { return stageCount; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    const string& getError() const { return error; }
+
+    // i번째 스테이지 (0부터)
+    StageView stage(int i) const { return StageView(data + loadU32(data + LEVEL_PACK_HEADER + 4 * i)); }
+
+private:
+    bool fail(const string& message);  // 오류 기록 후 닫기
+    bool validate(const string& name); // 스테이지 표, 머리, 칸 검사
+
+    const uint8_t* data;    // 매핑된 파일 또는 owned
+    size_t length;          // 파일 크기
+    bool mapped;            // mmap으로 연 경우
+    vector<uint8_t> owned;  // openBuffer()로 넘겨받은 바이트
+    int stageCount;
+    int width, height;      // 모든 스테이지 공통 크기
+    string error;
+};
+
+#endif
@@ -0,0 +1,196 @@
+#include "protocol.hpp"
+#include "netio.hpp"
+#include "profiler.hpp"
+#include "rng.hpp"
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+// 부하 발생기 - 한 프로세스에서 세션 수천 개를 열어 서버의 틱 처리량과 지연을 잼
+// 지연 = 서버가 틱을 시작한 시각(TICK에 붙은 시각)부터 이 프로세스가 그 프레임을 적용한 시각까지
+// (같은 호스트의 단조 시계를 쓰므로 로컬 서버에서만 의미가 있음)
+
+const int LOAD_MAX_EVENTS = 512;
+const int LOAD_POLL_MS = 5;
+
+// LoadClient 구조체 - 세션 하나 (BoardMirror로 프레임을 실제로 적용해 프로토콜도 함께 검사함)
+struct LoadClient {
+    Connection io;
+    BoardMirror mirror;
+    Rng rng;
+    bool alive = true;
+    bool restartSent = false;     // 게임 오버 뒤 RESTART를 보냄 - SNAPSHOT을 받으면 해제
+};
+
+// 부하 통계
+struct LoadStats {
+    PhaseHistogram latency;       // 틱 지연 (ns)
+    long ticks = 0;               // 측정 구간에 받은 TICK 수
+    long snapshots = 0;
+    long games = 0;               // 다시 시작한 게임 수
+    long badFrames = 0;
+    long disconnects = 0;
+    uint64_t bytes = 0;           // 측정 구간에 받은 바이트
+};
+
+static uint64_t nowNs() {
+    return static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// 메시지 보내기
+static void sendMessage(LoadClient& client, MessageType type, int value) {
+    if (value < 0) {
+        writeFrame(client.io.output, type);
+    } else {
+        vector<uint8_t> body(1, static_cast<uint8_t>(value));
+        writeFrame(client.io.output, type, body);
+    }
+}
+
+// 받은 프레임 적용 후 다음 입력 결정 - 가끔 좌/우로 꺾고, 끝난 게임은 다시 시작
+static bool serviceClient(LoadClient& client, int turnOneIn, bool measuring, LoadStats& stats) {
+    static const Action turns[4][2] = {
+        { ACT_LEFT, ACT_RIGHT }, { ACT_LEFT, ACT_RIGHT }, { ACT_UP, ACT_DOWN }, { ACT_UP, ACT_DOWN }
+    };
+
+    size_t before = client.io.input.size();
+    bool open = client.io.receive();
+    if (measuring) stats.bytes += client.io.input.size() - before;
+
+    MessageType type;
+    size_t begin, end;
+    while (true) {
+        FrameStatus status = readFrame(client.io.input, client.io.inputPos, type, begin, end);
+        if (status == FRAME_PARTIAL) break;
+        if (status == FRAME_BAD || !client.mirror.apply(type, client.io.input, begin, end)) {
+            ++stats.badFrames;
+            return false;
+        }
+
+        if (type == MSG_SNAPSHOT) {
+            ++stats.snapshots;
+            client.restartSent = false;
+            continue;
+        }
+        if (measuring) {
+            stats.latency.record(nowNs() - client.mirror.getLastTimestamp());
+            ++stats.ticks;
+        }
+        if (client.mirror.isOver()) {
+            if (!client.restartSent) {
+                sendMessage(client, MSG_RESTART, -1);
+                client.restartSent = true;
+                ++stats.games;
+            }
+        } else if (client.rng.below(turnOneIn) == 0) {
+            Direction dir = client.mirror.getSerpent().getCurrentDirection();
+            sendMessage(client, MSG_INPUT, turns[dir][client.rng.below(2)]);
+        }
+    }
+    client.io.compactInput();
+    return open && client.io.flush();
+}
+
+// 사용법 출력
+static int usage(const char* program) {
+    fprintf(stderr, "usage: %s [--connect unix:PATH | tcp:PORT] [--sessions N] [--seconds S] [--warmup S] [--turn N]\n",
+            program);
+    fprintf(stderr, "       --turn N: each session turns on about one tick in N (default 16)\n");
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    string address = DEFAULT_SERVER_ADDRESS;
+    int sessions = 1000;
+    double seconds = 10.0, warmup = 1.0;
+    int turnOneIn = 16;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc) address = argv[++i];
+        else if (strcmp(argv[i], "--sessions") == 0 && i + 1 < argc) sessions = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) warmup = atof(argv[++i]);
+        else if (strcmp(argv[i], "--turn") == 0 && i + 1 < argc) turnOneIn = atoi(argv[++i]);
+        else return usage(argv[0]);
+    }
+    if (sessions < 1 || seconds <= 0 || warmup < 0 || turnOneIn < 1) return usage(argv[0]);
+
+    long limit = raiseFileLimit();
+    if (limit > 0 && sessions + 16 > limit) {
+        fprintf(stderr, "file descriptor limit %ld is too low for %d sessions\n", limit, sessions);
+        return 1;
+    }
+
+    int epollFd = epoll_create1(0);
+    vector<unique_ptr<LoadClient>> clients;
+    clients.reserve(sessions);
+    LoadStats stats;
+
+    // 모두 연결하고 HELLO (서버 시각 요청)
+    auto connectStart = chrono::steady_clock::now();
+    vector<uint8_t> hello = { PROTOCOL_VERSION, HELLO_TIMESTAMPS };
+    for (int i = 0; i < sessions; ++i) {
+        string error;
+        int fd = connectSocket(address, error);
+        if (fd < 0) {
+            fprintf(stderr, "session %d: cannot connect to %s: %s\n", i, address.c_str(), error.c_str());
+            break;
+        }
+        clients.emplace_back(new LoadClient());
+        LoadClient& client = *clients.back();
+        client.io.fd = fd;
+        client.rng.reseed(static_cast<uint64_t>(i) + 1);
+        client.mirror.setTimestamps(true);
+        writeFrame(client.io.output, MSG_HELLO, hello);
+        client.io.flush();
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = static_cast<uint64_t>(i);
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+    if (clients.empty()) return 1;
+    double connectMs = chrono::duration<double, milli>(chrono::steady_clock::now() - connectStart).count();
+
+    // 예열 뒤부터 측정
+    auto start = chrono::steady_clock::now();
+    auto measureStart = start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(warmup));
+    auto deadline = measureStart + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(seconds));
+    epoll_event events[LOAD_MAX_EVENTS];
+    while (true) {
+        auto now = chrono::steady_clock::now();
+        if (now >= deadline) break;
+        bool measuring = now >= measureStart;
+
+        int n = epoll_wait(epollFd, events, LOAD_MAX_EVENTS, LOAD_POLL_MS);
+        for (int e = 0; e < n; ++e) {
+            LoadClient& client = *clients[events[e].data.u64];
+            if (!client.alive) continue;
+            if (!serviceClient(client, turnOneIn, measuring, stats)) {
+                client.alive = false;
+                ++stats.disconnects;
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, client.io.fd, nullptr);
+                client.io.close();
+            }
+        }
+    }
+
+    printf("sessions: %zu connected in %.1f ms, %ld disconnected, %ld bad frames\n", clients.size(), connectMs,
+           stats.disconnects, stats.badFrames);
+    printf("ticks: %ld in %.1f s (%.0f ticks/s, %.1f per session), %ld snapshots, %ld restarts\n", stats.ticks,
+           seconds, stats.ticks / seconds, stats.ticks / seconds / clients.size(), stats.snapshots, stats.games);
+    printf("latency: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us\n", stats.latency.mean() / 1000.0,
+           stats.latency.percentile(0.5) / 1000.0, stats.latency.percentile(0.99) / 1000.0,
+           stats.latency.getMax() / 1000.0);
+    printf("received: %.2f MB/s (%.1f bytes per tick)\n", stats.bytes / seconds / 1e6,
+           stats.ticks ? static_cast<double>(stats.bytes) / stats.ticks : 0.0);
+
+    for (auto& client : clients) client->io.close();
+    close(epollFd);
+    return 0;
+}
@@ -1,7 +1,239 @@
 #include "game.hpp"
+#include "replay.hpp"
+#include "client.hpp"
+#include "autopilot.hpp"
+#include "mcts.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+// 사용법 출력
+static int usage(const char* program) {
+    fprintf(stderr, "usage: %s [--seed N] [--size WxH | --levels PACK] [--record FILE] [--play FILE [--headless]]\n"
+                    "       [--profile FILE] [--autopilot | --mcts [--headless [--games N]]]\n", program);
+    fprintf(stderr, "       %s --connect unix:PATH | tcp:PORT   (play on a snake_server)\n", program);
+    fprintf(stderr, "       replays recorded with --levels must be played with the same pack\n");
+    fprintf(stderr, "       --size is at least 42x21; boards larger than the terminal scroll with the snake\n");
+    fprintf(stderr, "       --autopilot --headless plays N games with seeds S, S+1, ... (--seed S) without a screen\n");
+    fprintf(stderr, "       --mcts plays with tree search on all cores instead of the autopilot; on screen each move\n"
+                    "       is capped at %d ms, so it searches less (and plays worse) with few cores\n", MCTS_INTERACTIVE_MS);
+    return 1;
+}
+
+// 출력할 스테이지 - 전체 클리어 후에는 getStageLevel()이 마지막 스테이지를 하나 넘어가므로 마지막 스테이지로
+static int reachedStage(const GameState& state) {
+    return state.isCleared() ? state.getStageCount() : state.getStageLevel();
+}
+
+// 화면 없이 최대 속도로 리플레이 재생 후 결과 출력 (profilePath가 있으면 시뮬레이션 단계 시간도 저장)
+static int playHeadless(ReplayPlayer& player, const LevelPack* pack, const string& profilePath) {
+    GameState state(player.getWidth(), player.getHeight(), player.getSeed(), pack);
+    setProfilerEnabled(!profilePath.empty());
+
+    auto start = chrono::steady_clock::now();
+    long tick = 0;
+    while (!player.finished(tick)) {
+        Action action = player.next(tick++);
+        if (!state.step(action)) break;
+    }
+    auto end = chrono::steady_clock::now();
+
+    double seconds = chrono::duration<double>(end - start).count();
+    printf("ticks: %ld / %ld, stage: %d, length: %d, %s\n", tick, player.getFinalTick(),
+           reachedStage(state), state.getSerpent().length(), gameOverReasonName(state.getOverReason()));
+    printf("elapsed: %.3f ms (%.0f ticks/s)\n", seconds * 1000.0, seconds > 0 ? tick / seconds : 0.0);
+
+    if (!profilePath.empty()) {
+        setProfilerEnabled(false);
+        if (!saveProfile(profilePath)) {
+            fprintf(stderr, "cannot write profile: %s\n", profilePath.c_str());
+            return 1;
+        }
+        printf("profile: %s\n", profilePath.c_str());
+    }
+    return 0;
+}
+
+// 자동 조종기 요약 - 결정 시간과 다시 계획한 비율
+static void printBotSummary(const Autopilot& pilot, const PhaseHistogram& decideTimes, double) {
+    printf("decide: p50 %.2f us, p99 %.2f us, max %.2f us, replanned %.1f%% of %ld moves\n",
+           decideTimes.percentile(0.5) / 1000.0, decideTimes.percentile(0.99) / 1000.0, decideTimes.getMax() / 1000.0,
+           pilot.getDecisions() > 0 ? 100.0 * pilot.getReplans() / pilot.getDecisions() : 0.0, pilot.getDecisions());
+}
+
+// 트리 탐색 요약 - 결정 시간과 롤아웃 처리량
+static void printBotSummary(const MctsPlayer& player, const PhaseHistogram& decideTimes, double seconds) {
+    printf("decide: p50 %.2f ms, p99 %.2f ms, max %.2f ms, %ld rollouts (%.0f rollouts/s, %d threads)\n",
+           decideTimes.percentile(0.5) / 1e6, decideTimes.percentile(0.99) / 1e6, decideTimes.getMax() / 1e6,
+           player.getRollouts(), seconds > 0 ? player.getRollouts() / seconds : 0.0, player.getThreadCount());
+}
+
+// 화면 없이 봇(자동 조종기 또는 트리 탐색)으로 games판을 최대 속도로 진행 (소크 테스트) - 판마다 결과 한 줄과 전체 요약 출력
+// 시드는 화면 모드의 재시작과 같이 seed, seed + 1, ... 이라 문제가 된 판을 --autopilot --seed로 그대로 볼 수 있음
+template <typename Bot>
+static int soakHeadless(Bot& bot, int width, int height, uint64_t seed, int games, const LevelPack* pack,
+                        const string& profilePath) {
+    GameState state(width, height, seed, pack);
+    PhaseHistogram decideTimes;
+    setProfilerEnabled(!profilePath.empty());
+
+    int cleared = 0;
+    long ticks = 0;
+    auto start = chrono::steady_clock::now();
+    for (int game = 0; game < games; ++game) {
+        uint64_t gameSeed = seed + static_cast<uint64_t>(game);
+        if (game > 0) {
+            state.reset(gameSeed);
+            bot.clear();
+        }
+
+        bool alive = true;
+        while (alive) {
+            Action action = ACT_NONE;
+            if (state.movesOnNextStep()) {
+                auto before = chrono::steady_clock::now();
+                action = bot.decide(state);
+                decideTimes.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - before).count());
+            }
+            alive = state.step(action);
+        }
+
+        cleared += state.isCleared() ? 1 : 0;
+        ticks += state.getTotalTicks();
+        printf("game %d (seed %llu): stage %d, length %d, ticks %d, %s\n", game + 1,
+               static_cast<unsigned long long>(gameSeed), reachedStage(state), state.getSerpent().length(),
+               state.getTotalTicks(), gameOverReasonName(state.getOverReason()));
+        fflush(stdout);
+    }
+    auto end = chrono::steady_clock::now();
+
+    double seconds = chrono::duration<double>(end - start).count();
+    printf("cleared: %d / %d, ticks: %ld, elapsed: %.3f s (%.0f ticks/s)\n", cleared, games, ticks, seconds,
+           seconds > 0 ? ticks / seconds : 0.0);
+    printBotSummary(bot, decideTimes, seconds);
+
+    if (!profilePath.empty()) {
+        setProfilerEnabled(false);
+        if (!saveProfile(profilePath)) {
+            fprintf(stderr, "cannot write profile: %s\n", profilePath.c_str());
+            return 1;
+        }
+        printf("profile: %s\n", profilePath.c_str());
+    }
+    return 0;
+}
+
 // main 부분
-int main() {
-    StageController controller(42, 21);
+int main(int argc, char* argv[]) {
+    SessionOptions options;
+    options.seed = static_cast<uint64_t>(time(0));
+    options.player = nullptr;
+    options.pack = nullptr;
+    options.autopilot = false;
+    options.mcts = false;
+    string playPath, levelsPath, connectAddress;
+    bool headless = false;
+    int games = 1;
+    int width = 42, height = 21;
+    bool sizeSet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) options.seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) options.recordPath = argv[++i];
+        else if (strcmp(argv[i], "--play") == 0 && i + 1 < argc) playPath = argv[++i];
+        else if (strcmp(argv[i], "--levels") == 0 && i + 1 < argc) levelsPath = argv[++i];
+        else if (strcmp(argv[i], "--headless") == 0) headless = true;
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &width, &height) != 2 || width < MIN_BOARD_WIDTH || height < MIN_BOARD_HEIGHT ||
+                static_cast<long>(width) * height > MAX_BOARD_CELLS) {
+                return usage(argv[0]);
+            }
+            sizeSet = true;
+        }
+        else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc) options.profilePath = argv[++i];
+        else if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc) connectAddress = argv[++i];
+        else if (strcmp(argv[i], "--autopilot") == 0) options.autopilot = true;
+        else if (strcmp(argv[i], "--mcts") == 0) options.mcts = true;
+        else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = atoi(argv[++i]);
+            if (games < 1) return usage(argv[0]);
+        }
+        else return usage(argv[0]);
+    }
+
+    if (!options.profilePath.empty() && !profilerCompiledIn()) {
+        fprintf(stderr, "this build has no profiler (built with PROFILE=0)\n");
+        return 1;
+    }
+
+    // 서버에 붙는 클라이언트 - 게임 설정은 서버가 정함
+    if (!connectAddress.empty()) {
+        if (argc != 3) {
+            fprintf(stderr, "--connect cannot be combined with other options\n");
+            return 1;
+        }
+        RemoteController client(connectAddress);
+        string error;
+        if (!client.open(error)) {
+            fprintf(stderr, "cannot connect to %s: %s\n", connectAddress.c_str(), error.c_str());
+            return 1;
+        }
+        client.execute();
+        return 0;
+    }
+
+    if (sizeSet && (!levelsPath.empty() || !playPath.empty())) {
+        fprintf(stderr, "--size cannot be combined with --levels or --play (they set the board size)\n");
+        return 1;
+    }
+
+    LevelPack pack;
+    if (!levelsPath.empty()) {
+        if (!pack.open(levelsPath)) {
+            fprintf(stderr, "cannot read levels: %s\n", pack.getError().c_str());
+            return 1;
+        }
+        width = pack.getWidth();
+        height = pack.getHeight();
+        options.pack = &pack;
+    }
+
+    bool bot = options.autopilot || options.mcts;
+    if (options.autopilot && options.mcts) return usage(argv[0]);
+    if (bot && !playPath.empty()) {
+        fprintf(stderr, "%s cannot be combined with --play\n", options.autopilot ? "--autopilot" : "--mcts");
+        return 1;
+    }
+    if (games != 1 && !(bot && headless)) return usage(argv[0]);
+    if (options.autopilot && headless) {
+        Autopilot pilot(width, height);
+        return soakHeadless(pilot, width, height, options.seed, games, options.pack, options.profilePath);
+    }
+    if (options.mcts && headless) {
+        MctsPlayer player(width, height);
+        return soakHeadless(player, width, height, options.seed, games, options.pack, options.profilePath);
+    }
+
+    ReplayPlayer player;
+    if (!playPath.empty()) {
+        if (!player.load(playPath, options.pack)) {
+            fprintf(stderr, "cannot read replay: %s (bad file, board size out of range or not the level pack's)\n",
+                    playPath.c_str());
+            return 1;
+        }
+        if (headless) return playHeadless(player, options.pack, options.profilePath);
+
+        width = player.getWidth();
+        height = player.getHeight();
+        options.seed = player.getSeed();
+        options.player = &player;
+    } else if (headless) {
+        return usage(argv[0]);
+    }
+
+    StageController controller(width, height, options);
     controller.execute();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,262 @@
+#include "mcts.hpp"
+#include "input.hpp"
+#include "profiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+// 방향별 이동 (UP, DOWN, LEFT, RIGHT 순서)
+static const int stepX[4] = { 0, 0, -1, 1 };
+static const int stepY[4] = { -1, 1, 0, 0 };
+
+// 반대 방향
+static const Direction opposite[4] = { DOWN, UP, RIGHT, LEFT };
+
+const float MCTS_EXPLORATION = 0.1f;  // UCB1 탐험 계수 - 평가값 차이가 대개 0.1 안쪽이라 작게 둠
+const float MCTS_DISCOUNT = 0.95f;    // 이동마다 진행 가치를 줄이는 비율 - 같은 진행이면 빨리 한 쪽이 높음
+const float MCTS_MARGIN = 0.01f;      // 자동 조종기와 다른 방향을 고르려면 평균 평가값이 이만큼 높아야 함
+const float MCTS_STAGE_GAIN = 1.25f;  // 스테이지를 넘기면 달성률 1.25만큼 진행한 것으로 봄
+
+// 입력 -> 이동 방향 (ACT_NONE은 지금 방향 그대로)
+static Direction directionOf(Action action, Direction heading) {
+    return action == ACT_NONE ? heading : static_cast<Direction>(action - ACT_UP);
+}
+
+// 이동 한 번 - action을 입력하고 뱀이 다시 움직일 틱 직전(또는 게임 끝)까지 진행
+static void advanceMove(GameState& state, Action action) {
+    state.step(action);
+    while (!state.isOver() && !state.movesOnNextStep()) state.step(ACT_NONE);
+}
+
+// 생성자 - 트리마다 자동 조종기 버퍼를 한 번만 잡음
+MctsPlayer::MctsPlayer(int width, int height, const MctsOptions& options)
+    : width(width), height(height), options(options), pool(options.threads), rootState(nullptr), rootStage(0),
+      rootProgress(0.0f), decisions(0), rollouts(0), nodeBytes(0) {
+    if (this->options.trees < 1) this->options.trees = 1;
+    if (this->options.rollouts < this->options.trees) this->options.rollouts = this->options.trees;
+    for (int t = 0; t < this->options.trees; ++t) trees.emplace_back(new Tree(width, height));
+}
+
+// 새 게임 - 롤아웃 난수는 이동 번호로 정하므로 번호만 되돌림
+void MctsPlayer::clear() {
+    decisions = 0;
+    for (auto& tree : trees) tree->pilot.clear();
+}
+
+// 이번 틱 입력 - 트리들을 병렬로 키우고 루트 자식의 평가값을 합쳐 방향을 고름
+Action MctsPlayer::decide(const GameState& state) {
+    if (state.isOver() || !state.movesOnNextStep()) return ACT_NONE;
+    PROFILE_SCOPE(PHASE_MCTS);
+
+    // 모든 롤아웃이 복사해 가는 루트 - 화면용 변경 칸 추적은 끔
+    GameState base(state);
+    base.setDamageTracking(false);
+    rootState = &base;
+    rootStage = state.getStageLevel();
+    rootProgress = progress(state);
+    deadline = chrono::steady_clock::now() + chrono::milliseconds(options.budgetMs);
+
+    // 기준 수 - 자동 조종기가 지금 고르는 방향 (모든 트리가 루트에서 처음 펼치는 자식과 같음)
+    Direction current = state.getSerpent().getCurrentDirection();
+    trees[0]->pilot.clear();
+    Direction guide = directionOf(trees[0]->pilot.decide(base), current);
+
+    int count = static_cast<int>(trees.size());
+    for (int t = 0; t < count; ++t) {
+        Tree& tree = *trees[t];
+        tree.nodes.reset();
+        tree.root = tree.nodes.make<Node>();
+        tree.rng.reseed((options.seed << 32) + static_cast<uint64_t>(decisions) * count + t);
+        tree.rollouts = 0;
+    }
+    ++decisions;
+
+    auto body = [this](int begin, int end) { growRange(begin, end); };
+    pool.parallelFor(count, 1, body);
+    rootState = nullptr;
+
+    // 트리별 루트 자식의 가장 좋은 수순 평가값을 방문 수로 가중 평균
+    uint32_t visits[4] = { 0, 0, 0, 0 };
+    float values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    nodeBytes = 0;
+    for (auto& tree : trees) {
+        for (int d = 0; d < 4; ++d) {
+            const Node* child = tree->root->child[d];
+            if (!child) continue;
+            visits[d] += child->visits;
+            values[d] += bestLine(child) * child->visits;
+        }
+        rollouts += tree->rollouts;
+        nodeBytes += tree->nodes.used();
+    }
+
+    // 기준 수를 두되, 다른 방향의 평가값이 MCTS_MARGIN 넘게 높을 때만 바꿈 (잡음 수준의 차이로 흔들리지 않게)
+    Direction best = guide;
+    float bestMean = visits[guide] > 0 ? values[guide] / visits[guide] + MCTS_MARGIN : -1.0f;
+    for (int d = 0; d < 4; ++d) {
+        if (visits[d] == 0 || d == guide) continue;
+        float mean = values[d] / visits[d];
+        if (mean > bestMean) {
+            bestMean = mean;
+            best = static_cast<Direction>(d);
+        }
+    }
+    return best == current ? ACT_NONE : actionFor(best);
+}
+
+// [begin, end) 트리 키우기 - 롤아웃 수를 트리들에 고르게 나눔
+void MctsPlayer::growRange(int begin, int end) {
+    int count = static_cast<int>(trees.size());
+    for (int t = begin; t < end; ++t) {
+        grow(*trees[t], options.rollouts / count + (t < options.rollouts % count ? 1 : 0));
+    }
+}
+
+// 트리 하나 키우기 - 시간 상한이 있으면 마감이 지난 뒤로는 반복하지 않음 (루트 통계는 돌린 만큼만 합쳐짐)
+void MctsPlayer::grow(Tree& tree, int iterations) {
+    for (int i = 0; i < iterations; ++i) {
+        if (options.budgetMs > 0 && chrono::steady_clock::now() >= deadline) break;
+        iterate(tree);
+    }
+}
+
+// 반복 한 번 - 루트 상태를 복사해 트리를 따라 내려가고, 새 노드에서 롤아웃한 평가값을 지나온 노드에 더함
+void MctsPlayer::iterate(Tree& tree) {
+    GameState state(*rootState);
+    Outcome outcome = { rootProgress, 0.0f, 1.0f, false };
+    tree.path.clear();
+    tree.path.push_back(tree.root);
+
+    Node* node = tree.root;
+    for (;;) {
+        if (state.isOver() || outcome.stageDone) break;
+        Direction move;
+        Node* next = select(tree, node, state, move);
+        advanceMove(state, actionFor(move));
+        credit(outcome, state);
+        tree.path.push_back(next);
+        if (next->visits == 0) {
+            rollout(tree, state, outcome);
+            break;
+        }
+        node = next;
+    }
+
+    float value = evaluate(state, outcome);
+    for (Node* visited : tree.path) {
+        ++visited->visits;
+        visited->value += value;
+    }
+}
+
+// 노드에서 이어지는 가장 좋은 수순의 평가값 - 게임에 우연이 없고 뒤의 수는 모두 봇이 고르므로 평균 대신 최댓값
+// (평균으로 올리면 탐험 삼아 둔 나쁜 수가 좋은 수순의 값을 끌어내림) - 펼친 자식이 없으면 노드 자신의 평균
+float MctsPlayer::bestLine(const Node* node) {
+    float best = -1.0f;
+    for (const Node* child : node->child) {
+        if (child && child->visits > 0) best = max(best, bestLine(child));
+    }
+    return best >= 0.0f ? best : node->value / node->visits;
+}
+
+// 다음 노드 - 아직 안 가 본 방향이 있으면 하나를 만들고, 다 가 봤으면 UCB1이 가장 큰 자식
+// 처음 펼치는 노드는 자동 조종기가 고른 방향부터 만들어 첫 평가가 곧 자동 조종기대로 둔 결과가 되게 함
+// 역방향은 바로 게임 오버라 후보에서 뺌
+MctsPlayer::Node* MctsPlayer::select(Tree& tree, Node* node, const GameState& state, Direction& move) {
+    Direction heading = state.getSerpent().getCurrentDirection();
+    int untried[3];
+    int untriedCount = 0;
+    for (int d = 0; d < 4; ++d) {
+        if (d != opposite[heading] && !node->child[d]) untried[untriedCount++] = d;
+    }
+    if (untriedCount > 0) {
+        if (untriedCount == 3) {
+            tree.pilot.clear();
+            move = directionOf(tree.pilot.decide(state), heading);
+        } else {
+            move = static_cast<Direction>(untried[tree.rng.below(untriedCount)]);
+        }
+        node->child[move] = tree.nodes.make<Node>();
+        return node->child[move];
+    }
+
+    float logVisits = log(static_cast<float>(node->visits));
+    float bestScore = -1.0f;
+    Node* best = nullptr;
+    for (int d = 0; d < 4; ++d) {
+        Node* child = node->child[d];
+        if (d == opposite[heading] || !child) continue;
+        float score = child->value / child->visits + MCTS_EXPLORATION * sqrt(logVisits / child->visits);
+        if (score > bestScore) {
+            bestScore = score;
+            best = child;
+            move = static_cast<Direction>(d);
+        }
+    }
+    return best;
+}
+
+// 롤아웃 - 스테이지를 넘기거나 끝날 때까지 최대 depth 이동, 대부분은 자동 조종기를 따르고
+// noisePercent 비율로 벽/몸통이 아닌 무작위 방향 (자동 조종기는 다음 이동에서 알아서 다시 계획함)
+void MctsPlayer::rollout(Tree& tree, GameState& state, Outcome& outcome) {
+    ++tree.rollouts;
+    tree.pilot.clear();
+    for (int moves = 0; moves < options.depth && !state.isOver() && !outcome.stageDone; ++moves) {
+        Action action = ACT_NONE;
+        if (static_cast<int>(tree.rng.below(100)) >= options.noisePercent || !randomMove(tree, state, action)) {
+            action = tree.pilot.decide(state);
+        }
+        advanceMove(state, action);
+        credit(outcome, state);
+    }
+}
+
+// 벽/몸통이 아닌 이웃 중 무작위 방향 - 없으면 false
+bool MctsPlayer::randomMove(Tree& tree, const GameState& state, Action& action) const {
+    const Serpent& serpent = state.getSerpent();
+    auto head = serpent.getHeadPosition();
+    Direction heading = serpent.getCurrentDirection();
+    int open[3];
+    int openCount = 0;
+    for (int d = 0; d < 4; ++d) {
+        if (d == opposite[heading]) continue;
+        int x = head.first + stepX[d], y = head.second + stepY[d];
+        if (x < 0 || x >= width || y < 0 || y >= height) continue;
+        Cell cell = state.cellAt(x, y);
+        if (cell == CELL_WALL || cell == CELL_IMMUNE_WALL || serpent.occupies(x, y)) continue;
+        open[openCount++] = d;
+    }
+    if (openCount == 0) return false;
+    action = actionFor(static_cast<Direction>(open[tree.rng.below(openCount)]));
+    return true;
+}
+
+// 이동 한 번의 진행을 할인해 더함 - 스테이지를 넘기면(마지막 스테이지 클리어 포함) 남은 달성률과 스테이지 보너스
+void MctsPlayer::credit(Outcome& outcome, const GameState& state) const {
+    if (state.isOver() && !state.isCleared()) return;
+    float now = progress(state);
+    float gained = now - outcome.progress;
+    if (state.getStageLevel() != rootStage) {
+        gained = 1.0f - outcome.progress + MCTS_STAGE_GAIN;
+        outcome.stageDone = true;
+    }
+    outcome.progress = now;
+    outcome.gain += outcome.discount * gained;
+    outcome.discount *= MCTS_DISCOUNT;
+}
+
+// 평가 - 죽으면 0, 그 밖에는 0.5에 할인한 진행을 더함 (같은 스테이지 클리어도 빨리 할수록 높음)
+float MctsPlayer::evaluate(const GameState& state, const Outcome& outcome) const {
+    if (state.isOver() && !state.isCleared()) return 0.0f;
+    return max(0.01f, min(1.0f, 0.5f + 0.2f * outcome.gain));
+}
+
+// 미션 달성률 - 길이/성장/독/게이트 미션마다 min(1, 점수 / 목표)의 평균
+float MctsPlayer::progress(const GameState& state) {
+    const int scores[4] = { state.getSerpent().length(), state.getGrowScore(), state.getPoisonScore(), state.getGateScore() };
+    const int missions[4] = { state.getMissionLen(), state.getMissionGrow(), state.getMissionPoison(), state.getMissionGate() };
+    float sum = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        sum += missions[i] <= 0 ? 1.0f : min(1.0f, static_cast<float>(scores[i]) / missions[i]);
+    }
+    return sum / 4.0f;
+}
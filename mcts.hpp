@@ -0,0 +1,108 @@
+#ifndef MCTS_HPP
+#define MCTS_HPP
+
+#include "simulation.hpp"
+#include "autopilot.hpp"
+#include "threadpool.hpp"
+#include "bumparena.hpp"
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+using namespace std;
+
+const int MCTS_ROLLOUTS = 256;       // 기본 - 이동 한 번에 돌리는 롤아웃 수 (모든 트리 합계)
+const int MCTS_TREES = 8;            // 기본 - 따로 키우는 트리 수 (코어 수와 무관해야 결과가 같음)
+const int MCTS_DEPTH = 24;           // 기본 - 트리 아래에서 롤아웃으로 더 두는 이동 수
+const int MCTS_NOISE_PERCENT = 5;    // 기본 - 롤아웃에서 자동 조종기 대신 무작위로 두는 비율
+const int MCTS_INTERACTIVE_MS = 10;  // 화면 게임 - 이동 한 번의 탐색 시간 상한 (한 틱 25ms 안에 그리기까지 끝나게)
+
+// 트리 탐색 설정
+struct MctsOptions {
+    int rollouts;        // 이동 한 번에 돌리는 롤아웃 수 (트리들에 나눠 줌)
+    int trees;           // 트리 수 - 트리 하나는 한 번에 한 스레드만 키움
+    int depth;           // 롤아웃 길이 (이동 수)
+    int noisePercent;    // 롤아웃 무작위 이동 비율 (0~100)
+    int threads;         // 스레드 수 - 0 이하이면 코어 수만큼
+    int budgetMs;        // 이동 한 번의 탐색 시간 상한 - 0 이하이면 rollouts를 모두 돌림 (시간에 따라 수가 달라지지 않음)
+    uint64_t seed;       // 롤아웃 난수 시드
+
+    MctsOptions()
+        : rollouts(MCTS_ROLLOUTS), trees(MCTS_TREES), depth(MCTS_DEPTH), noisePercent(MCTS_NOISE_PERCENT),
+          threads(0), budgetMs(0), seed(1) {}
+};
+
+// MctsPlayer 클래스 - 몬테카를로 트리 탐색으로 방향을 정하는 봇
+// 반복마다 지금 GameState를 복사(fork)해 step()으로 그대로 진행하므로 아이템, 독, 게이트, 바람개비,
+// 미션과 스테이지 진행이 실제 게임과 똑같이 반영됨 (게임이 결정적이라 트리의 노드 하나가 상태 하나)
+// 롤아웃 정책은 자동 조종기(Autopilot)이고, 스테이지를 넘기면 거기서 끝내고 빨리 넘길수록 높게 평가함
+// 루트 병렬화 - 트리마다 노드 아레나/자동 조종기/난수를 따로 두고 한 작업이 트리 하나를 맡아 키운 뒤
+// 루트 자식의 평가값만 합치므로 노드 통계에 잠금도 원자 연산도 필요 없음
+// 노드는 트리의 BumpArena에서 잘라 쓰고 이동마다 reset()함
+class MctsPlayer {
+public:
+    MctsPlayer(int width, int height, const MctsOptions& options = MctsOptions());
+
+    // 이번 틱 입력 - 뱀이 움직이지 않는 틱과 방향을 바꾸지 않는 틱은 ACT_NONE
+    Action decide(const GameState& state);
+
+    // 새 게임 - 롤아웃 난수를 처음부터 다시 씀 (같은 시드의 게임은 같은 수를 둠)
+    void clear();
+
+    int getThreadCount() const { return pool.size(); }
+    long getDecisions() const { return decisions; }  // 트리 탐색을 한 이동 수
+    long getRollouts() const { return rollouts; }    // 지금까지 돌린 롤아웃 수
+    size_t getNodeBytes() const { return nodeBytes; } // 마지막 이동에서 노드에 쓴 바이트 (모든 트리)
+
+private:
+    // 트리 노드 - 자식은 이동 방향별, 값은 롤아웃 평가의 합
+    struct Node {
+        Node* child[4];
+        uint32_t visits;
+        float value;
+    };
+
+    // 반복 한 번의 진행 기록 - 이동마다 달성률이 오른 만큼을 할인해 더함
+    struct Outcome {
+        float progress;      // 마지막으로 본 달성률
+        float gain;          // 할인한 진행 합계
+        float discount;      // 다음 이동의 할인 배율
+        bool stageDone;      // 스테이지를 넘김 - 다음 스테이지는 처음부터 새로 놓이므로 여기서 끝냄
+    };
+
+    // 트리 하나 - 한 작업만 만지므로 잠금이 없음
+    struct Tree {
+        BumpArena nodes;         // 이번 이동의 노드 (이동마다 reset)
+        Autopilot pilot;         // 롤아웃 정책
+        Rng rng;
+        Node* root;
+        vector<Node*> path;      // 이번 반복에서 지나간 노드
+        long rollouts;           // 이번 이동에 돌린 롤아웃 수
+        Tree(int width, int height) : pilot(width, height), root(nullptr), rollouts(0) {}
+    };
+
+    void growRange(int begin, int end);                 // [begin, end) 트리 키우기
+    void grow(Tree& tree, int iterations);              // 트리 하나에 반복 iterations번
+    void iterate(Tree& tree);                           // 선택 - 확장 - 롤아웃 - 역전파 한 번
+    void rollout(Tree& tree, GameState& state, Outcome& outcome);    // 자동 조종기로 depth 이동
+    bool randomMove(Tree& tree, const GameState& state, Action& action) const;  // 롤아웃 무작위 이동
+    void credit(Outcome& outcome, const GameState& state) const;     // 이동 한 번의 진행 기록
+    float evaluate(const GameState& state, const Outcome& outcome) const;  // 0(죽음)~1(전체 클리어)
+    Node* select(Tree& tree, Node* node, const GameState& state, Direction& move);  // UCB1 또는 새 자식
+    static float bestLine(const Node* node);            // 가장 좋은 수순의 평가값
+    static float progress(const GameState& state);      // 이번 스테이지 미션 달성률 (0~1)
+
+    int width, height;
+    MctsOptions options;
+    ThreadPool pool;
+    vector<unique_ptr<Tree>> trees;
+    const GameState* rootState;    // decide() 동안만 유효
+    int rootStage;                 // 루트의 스테이지
+    float rootProgress;            // 루트의 미션 달성률
+    chrono::steady_clock::time_point deadline;  // budgetMs가 있을 때 이번 이동의 탐색 마감
+    long decisions, rollouts;
+    size_t nodeBytes;
+};
+
+#endif
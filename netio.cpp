@@ -0,0 +1,175 @@
+#include "netio.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdlib>
+
+// 논블로킹 설정
+static bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// 주소 해석 - sockaddr와 길이를 채움
+static bool parseAddress(const string& address, sockaddr_storage& storage, socklen_t& length, string& error) {
+    memset(&storage, 0, sizeof(storage));
+    if (address.compare(0, 5, "unix:") == 0) {
+        string path = address.substr(5);
+        sockaddr_un* un = reinterpret_cast<sockaddr_un*>(&storage);
+        if (path.empty() || path.size() >= sizeof(un->sun_path)) {
+            error = "bad unix socket path: " + path;
+            return false;
+        }
+        un->sun_family = AF_UNIX;
+        memcpy(un->sun_path, path.c_str(), path.size() + 1);
+        length = sizeof(sockaddr_un);
+        return true;
+    }
+    if (address.compare(0, 4, "tcp:") == 0) {
+        int port = atoi(address.c_str() + 4);
+        if (port <= 0 || port > 65535) {
+            error = "bad tcp port: " + address.substr(4);
+            return false;
+        }
+        sockaddr_in* in = reinterpret_cast<sockaddr_in*>(&storage);
+        in->sin_family = AF_INET;
+        in->sin_port = htons(static_cast<uint16_t>(port));
+        in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        length = sizeof(sockaddr_in);
+        return true;
+    }
+    error = "address must be unix:PATH or tcp:PORT";
+    return false;
+}
+
+// 리스닝 소켓 - Unix 소켓은 남아 있던 파일을 지우고 만듦
+int listenSocket(const string& address, string& error) {
+    sockaddr_storage storage;
+    socklen_t length;
+    if (!parseAddress(address, storage, length, error)) return -1;
+
+    int fd = socket(storage.ss_family, SOCK_STREAM, 0);
+    if (fd < 0) {
+        error = strerror(errno);
+        return -1;
+    }
+    if (storage.ss_family == AF_UNIX) {
+        unlink(reinterpret_cast<sockaddr_un*>(&storage)->sun_path);
+    } else {
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    }
+    if (bind(fd, reinterpret_cast<sockaddr*>(&storage), length) < 0 || listen(fd, SOMAXCONN) < 0 ||
+        !setNonBlocking(fd)) {
+        error = strerror(errno);
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 연결 - 작은 프레임이 바로 나가도록 TCP는 Nagle을 끔
+int connectSocket(const string& address, string& error) {
+    sockaddr_storage storage;
+    socklen_t length;
+    if (!parseAddress(address, storage, length, error)) return -1;
+
+    int fd = socket(storage.ss_family, SOCK_STREAM, 0);
+    if (fd < 0) {
+        error = strerror(errno);
+        return -1;
+    }
+    if (connect(fd, reinterpret_cast<sockaddr*>(&storage), length) < 0 || !setNonBlocking(fd)) {
+        error = strerror(errno);
+        ::close(fd);
+        return -1;
+    }
+    if (storage.ss_family == AF_INET) {
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+    return fd;
+}
+
+// 연결 받기 - TCP는 Nagle을 끔
+int acceptSocket(int listenFd) {
+    sockaddr_storage storage;
+    socklen_t length = sizeof(storage);
+    int fd = accept(listenFd, reinterpret_cast<sockaddr*>(&storage), &length);
+    if (fd < 0) return -1;
+    if (!setNonBlocking(fd)) {
+        ::close(fd);
+        return -1;
+    }
+    if (storage.ss_family == AF_INET) {
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+    return fd;
+}
+
+// 파일 디스크립터 한도 올리기
+long raiseFileLimit() {
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return -1;
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &limit);
+    getrlimit(RLIMIT_NOFILE, &limit);
+    return static_cast<long>(limit.rlim_cur);
+}
+
+// 읽을 수 있는 만큼 읽기
+bool Connection::receive() {
+    uint8_t chunk[16384];
+    while (true) {
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+        if (n > 0) {
+            input.insert(input.end(), chunk, chunk + n);
+            continue;
+        }
+        if (n == 0) return false;
+        if (errno == EINTR) continue;
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+}
+
+// 보낼 수 있는 만큼 보내기 - 다 보내면 버퍼를 비움
+bool Connection::flush() {
+    while (outputPos < output.size()) {
+        ssize_t n = send(fd, output.data() + outputPos, output.size() - outputPos, MSG_NOSIGNAL);
+        if (n > 0) {
+            outputPos += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        return false;
+    }
+    output.clear();
+    outputPos = 0;
+    return true;
+}
+
+// 처리한 입력 지우기
+void Connection::compactInput() {
+    if (inputPos == 0) return;
+    input.erase(input.begin(), input.begin() + inputPos);
+    inputPos = 0;
+}
+
+// 닫기
+void Connection::close() {
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+    input.clear();
+    output.clear();
+    inputPos = 0;
+    outputPos = 0;
+}
@@ -0,0 +1,50 @@
+#ifndef NETIO_HPP
+#define NETIO_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+// 소켓 도우미 - 주소는 "unix:경로" (Unix 도메인 소켓) 또는 "tcp:포트" (127.0.0.1만)
+const char* const DEFAULT_SERVER_ADDRESS = "tcp:7777";
+const size_t MAX_PENDING_OUTPUT = 4u << 20;   // 이보다 밀린 클라이언트는 끊음
+
+// 논블로킹 리스닝 소켓 - 실패 시 -1과 error
+int listenSocket(const string& address, string& error);
+
+// 연결 후 논블로킹으로 전환 - 실패 시 -1과 error
+int connectSocket(const string& address, string& error);
+
+// 대기 중인 연결 하나 받기 - 논블로킹으로 설정, 없으면 -1
+int acceptSocket(int listenFd);
+
+// 파일 디스크립터 한도를 최대로 올림 (세션 수천 개용) - 올린 뒤의 한도
+long raiseFileLimit();
+
+// Connection 구조체 - 논블로킹 소켓 하나와 읽기/쓰기 버퍼
+struct Connection {
+    int fd = -1;
+    vector<uint8_t> input;       // 받았지만 아직 처리하지 않은 바이트 (inputPos부터)
+    size_t inputPos = 0;
+    vector<uint8_t> output;      // 보낼 바이트 (outputPos부터)
+    size_t outputPos = 0;
+
+    // 지금 읽을 수 있는 만큼 읽음 - 상대가 닫았거나 오류면 false
+    bool receive();
+
+    // 보낼 수 있는 만큼 보냄 - 오류면 false
+    bool flush();
+
+    bool hasPendingOutput() const { return outputPos < output.size(); }
+    size_t pendingOutput() const { return output.size() - outputPos; }
+
+    // 처리한 입력을 버퍼 앞에서 지움
+    void compactInput();
+
+    void close();
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "painter.hpp"
+#include "simulation.hpp"
+#include "protocol.hpp"
+#include <algorithm>
+
+// 화면 초기화
+BoardPainter::BoardPainter(int width, int height)
+    : width(width), height(height), viewWidth(width), viewHeight(height), cameraX(0), cameraY(0), closed(false),
+      shownStage(-1), shownSeconds(-1) {
+    fill(shownScore, shownScore + 5, -1);
+    fill(shownMission, shownMission + 6, -1);
+
+    initscr(); // 커서 초기화
+    cbreak();
+    noecho();
+    curs_set(0); // 커서 없앰
+    keypad(stdscr, TRUE); // 키패드 활성화
+    timeout(0); // 입력은 기다리지 않음 - 틱 간격은 스케줄러가 맞춤
+    refresh(); // stdscr를 한 번 비워 두어 getch()가 창을 덮어쓰지 않게 함
+
+    // 화면 크기 - 오른쪽 창(32칸)과 아래 안내(2줄)를 뺀 터미널에 맞춤
+    viewWidth = min(width, max(20, COLS - 32));
+    viewHeight = min(height, max(10, LINES - 2));
+
+    mainWin = newwin(viewHeight, viewWidth, 0, 0); // 게임창
+    scoreBoard = newwin(7, 30, 4, viewWidth + 2); // 스코어보드 창
+    missionBoard = newwin(9, 30, 11, viewWidth + 2); // 미션 창
+    timeBoard = newwin(3, 30, 1, viewWidth + 2); // 시간 창
+}
+
+BoardPainter::~BoardPainter() {
+    close();
+}
+
+// 화면 정리
+void BoardPainter::close() {
+    if (closed) return;
+    closed = true;
+
+    delwin(mainWin);
+    delwin(scoreBoard);
+    delwin(missionBoard);
+    delwin(timeBoard);
+    endwin();
+}
+
+// 맵 아래 결과 안내
+void BoardPainter::showResult(const char* title, const char* reason, const char* keys) {
+    mvprintw(viewHeight, 0, "%s - %s", title, reason);
+    clrtoeol();
+    printw("  %s", keys);
+    wnoutrefresh(stdscr);
+    doupdate();
+}
+
+// 결과 아래 줄에 오류 표시
+void BoardPainter::showError(const string& text) {
+    mvprintw(viewHeight + 1, 0, "%s", text.c_str());
+}
+
+// 안내 지우기
+void BoardPainter::clearResult() {
+    move(viewHeight, 0);
+    clrtoeol();
+    move(viewHeight + 1, 0);
+    clrtoeol();
+    wnoutrefresh(stdscr);
+}
+
+// 화면 그리기 - 바뀐 칸과 바뀐 창만 다시 그림 (화면이 움직였으면 화면 안쪽 전체)
+template <typename Board>
+void BoardPainter::draw(Board& board) {
+    if (updateCamera(board) || board.needsFullRedraw()) {
+        drawBoard(board);
+    } else {
+        for (int index : board.getDirtyCells()) drawCell(board, index);
+    }
+    board.clearDamage();
+    wnoutrefresh(mainWin);
+
+    drawPanels(board);
+}
+
+// 한 축의 화면 위치 - 머리가 가장자리 1/4 안으로 들어오면 따라가고, 맵 밖은 보이지 않게 고정
+static int followAxis(int camera, int head, int view, int board) {
+    int margin = view / 4;
+    if (head < camera + margin) camera = head - margin;
+    else if (head >= camera + view - margin) camera = head - view + margin + 1;
+    return max(0, min(camera, board - view));
+}
+
+// 화면 위치 갱신 - 스테이지 시작 때는 머리를 가운데로
+template <typename Board>
+bool BoardPainter::updateCamera(const Board& board) {
+    auto head = board.getSerpent().getHeadPosition();
+    int x, y;
+    if (board.needsFullRedraw()) {
+        x = max(0, min(head.first - viewWidth / 2, width - viewWidth));
+        y = max(0, min(head.second - viewHeight / 2, height - viewHeight));
+    } else {
+        x = followAxis(cameraX, head.first, viewWidth, width);
+        y = followAxis(cameraY, head.second, viewHeight, height);
+    }
+    bool moved = x != cameraX || y != cameraY;
+    cameraX = x;
+    cameraY = y;
+    return moved;
+}
+
+// 맵 한 칸 그리기 - 뱀이 있으면 뱀이 우선, 화면 밖이면 무시
+template <typename Board>
+void BoardPainter::drawCell(const Board& board, int index) {
+    int x = index % width - cameraX;
+    int y = index / width - cameraY;
+    if (x < 0 || y < 0 || x >= viewWidth || y >= viewHeight) return;
+    chtype glyph = ' ';
+
+    if (board.getSerpent().occupiesIndex(index)) {
+        glyph = 'O';
+    } else {
+        switch (board.getMap().atIndex(index)) {
+            case CELL_WALL: glyph = '#'; break;
+            case CELL_IMMUNE_WALL: glyph = '*'; break;
+            case CELL_GROW: glyph = '+'; break;
+            case CELL_POISON: glyph = '-'; break;
+            case CELL_GATE: glyph = 'G'; break;
+            case CELL_BOOST: glyph = '>'; break;
+            case CELL_SLOW: glyph = '<'; break;
+            case CELL_EMPTY: break;
+        }
+    }
+    mvwaddch(mainWin, y, x, glyph);
+}
+
+// 화면 안쪽 맵 전체 그리기 - 스테이지 시작 시와 화면이 움직였을 때 (화면 넓이에 비례)
+template <typename Board>
+void BoardPainter::drawBoard(const Board& board) {
+    werase(mainWin);
+
+    const StageMap& map = board.getMap();
+    for (int y = cameraY; y < cameraY + viewHeight; ++y) {
+        for (int x = cameraX; x < cameraX + viewWidth; ++x) {
+            int index = map.index(x, y);
+            if (map.atIndex(index) != CELL_EMPTY || board.getSerpent().occupiesIndex(index)) drawCell(board, index);
+        }
+    }
+}
+
+// 점수/미션/시간 창 그리기 - 값이 바뀐 창만
+template <typename Board>
+void BoardPainter::drawPanels(const Board& board) {
+    StatusValues status = statusOf(board);
+
+    if (shownStage != status.stage) {
+        shownStage = status.stage;
+        mvprintw(0, viewWidth + 5, "Stage %d", shownStage);
+        wnoutrefresh(stdscr);
+    }
+
+    int elapsedSeconds = board.getStageTicks() * TICK_MS / 1000;
+    if (shownSeconds != elapsedSeconds) {
+        shownSeconds = elapsedSeconds;
+        int minutes = elapsedSeconds / 60;
+        int seconds = elapsedSeconds % 60;
+
+        werase(timeBoard);
+        box(timeBoard, 0, 0);
+        mvwprintw(timeBoard, 1, 1, "Time: %02d:%02d", minutes, seconds);
+        wnoutrefresh(timeBoard);
+    }
+
+    const int* score = status.score;
+    if (!equal(score, score + 5, shownScore)) {
+        copy(score, score + 5, shownScore);
+
+        werase(scoreBoard);
+        box(scoreBoard, 0, 0);
+        mvwprintw(scoreBoard, 1, 1, "Score Board");
+        mvwprintw(scoreBoard, 2, 1, "B: %d / %d", score[0], score[1]);
+        mvwprintw(scoreBoard, 3, 1, "+: %d", score[2]);
+        mvwprintw(scoreBoard, 4, 1, "-: %d", score[3]);
+        mvwprintw(scoreBoard, 5, 1, "G: %d", score[4]);
+        wnoutrefresh(scoreBoard);
+    }
+
+    // 미션 목표와 완료 여부 (완료 여부는 비트로 묶음)
+    const int* mission = status.mission;
+    int doneMask = mission[5];
+    if (!equal(mission, mission + 6, shownMission)) {
+        copy(mission, mission + 6, shownMission);
+
+        werase(missionBoard);
+        box(missionBoard, 0, 0);
+        mvwprintw(missionBoard, 1, 1, "Mission");
+        mvwprintw(missionBoard, 2, 1, "Pass the stage in 2 minutes");
+        mvwprintw(missionBoard, 3, 1, "B: %d (%c)", mission[0], (doneMask & 1) ? 'v' : ' ');
+        mvwprintw(missionBoard, 4, 1, "Max B: %d (%c)", mission[1], (doneMask & 2) ? 'v' : ' ');
+        mvwprintw(missionBoard, 5, 1, "+: %d (%c)", mission[2], (doneMask & 4) ? 'v' : ' ');
+        mvwprintw(missionBoard, 6, 1, "-: %d (%c)", mission[3], (doneMask & 8) ? 'v' : ' ');
+        mvwprintw(missionBoard, 7, 1, "G: %d (%c)", mission[4], (doneMask & 16) ? 'v' : ' ');
+        wnoutrefresh(missionBoard);
+    }
+}
+
+// 로컬 게임과 원격 클라이언트용 인스턴스
+template void BoardPainter::draw<GameState>(GameState& board);
+template void BoardPainter::draw<BoardMirror>(BoardMirror& board);
@@ -0,0 +1,56 @@
+#ifndef PAINTER_HPP
+#define PAINTER_HPP
+
+#include <string>
+#include <ncurses.h>
+
+using namespace std;
+
+// BoardPainter 클래스 - 맵과 점수/미션/시간 창을 ncurses 화면에 그림
+// 로컬 게임(GameState)과 서버에 붙은 클라이언트(BoardMirror)가 같은 코드로 그려짐
+// 맵이 터미널보다 크면 머리를 따라가는 화면(viewport) 안쪽만 그림
+class BoardPainter {
+public:
+    BoardPainter(int width, int height);     // 화면 초기화
+    ~BoardPainter();
+
+    // 바뀐 칸과 바뀐 창을 화면 버퍼에 그림 - 실제 출력(doupdate)은 부르는 쪽에서
+    // Board는 GameState나 BoardMirror (같은 조회 함수를 가짐)
+    template <typename Board>
+    void draw(Board& board);
+
+    void showResult(const char* title, const char* reason, const char* keys);  // 맵 아래 결과 안내
+    void showError(const string& text);      // 결과 아래 줄에 오류 표시
+    void clearResult();                      // 안내 지우기 (재시작)
+    void close();                            // 화면 정리 - 한 번만 실행됨
+
+    int getViewWidth() const { return viewWidth; }
+
+private:
+    template <typename Board>
+    bool updateCamera(const Board& board);   // 화면 위치를 머리에 맞춤 - 움직였으면 true
+    template <typename Board>
+    void drawCell(const Board& board, int index);  // 맵 한 칸 그리기
+    template <typename Board>
+    void drawBoard(const Board& board);      // 화면 안쪽 맵 전체 그리기
+    template <typename Board>
+    void drawPanels(const Board& board);     // 점수/미션/시간 창 (값이 바뀔 때만)
+
+    int width, height;                       // 맵 크기
+    int viewWidth, viewHeight;               // 화면에 보이는 맵 크기 (터미널에 맞춤)
+    int cameraX, cameraY;                    // 화면 왼쪽 위가 가리키는 맵 좌표
+    bool closed;
+
+    // 마지막으로 그린 값 - 바뀐 창만 다시 그림
+    int shownStage;
+    int shownSeconds;
+    int shownScore[5];
+    int shownMission[6];
+
+    WINDOW* mainWin;
+    WINDOW* scoreBoard;
+    WINDOW* missionBoard;
+    WINDOW* timeBoard;
+};
+
+#endif
@@ -0,0 +1,101 @@
+#include "profiler.hpp"
+
+static PhaseHistogram histograms[PHASE_COUNT];
+atomic<bool> profilerActive(false);
+
+// 단계 이름
+const char* profilePhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case PHASE_INPUT:      return "input";
+        case PHASE_STEP:       return "step";
+        case PHASE_RENDER:     return "render";
+        case PHASE_OUTPUT:     return "output";
+        case PHASE_SIM_TICK:   return "sim.tick";
+        case PHASE_SIM_TIMERS: return "sim.timers";
+        case PHASE_SIM_ITEMS:  return "sim.items";
+        case PHASE_AUTOPILOT:  return "autopilot";
+        case PHASE_MCTS:       return "mcts";
+        case PHASE_COUNT:      break;
+    }
+    return "?";
+}
+
+// 구간 번호 - 8 미만은 그대로, 그 위는 최상위 비트 + 다음 3비트
+int PhaseHistogram::bucketFor(uint64_t ns) {
+    if (ns < SUB_BUCKETS) return static_cast<int>(ns);
+    int msb = 63 - __builtin_clzll(ns);
+    int bucket = (msb - 2) * SUB_BUCKETS + static_cast<int>((ns >> (msb - 3)) & (SUB_BUCKETS - 1));
+    return bucket < BUCKET_COUNT ? bucket : BUCKET_COUNT - 1;
+}
+
+// 구간 중앙값
+uint64_t PhaseHistogram::bucketMiddle(int bucket) {
+    if (bucket < SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+    int msb = bucket / SUB_BUCKETS + 2;
+    uint64_t low = static_cast<uint64_t>(SUB_BUCKETS + bucket % SUB_BUCKETS) << (msb - 3);
+    return low + ((static_cast<uint64_t>(1) << (msb - 3)) >> 1);
+}
+
+// 분위수
+uint64_t PhaseHistogram::percentile(double q) const {
+    uint64_t count = getCount();
+    if (count == 0) return 0;
+    uint64_t target = static_cast<uint64_t>(q * count + 0.5);
+    if (target < 1) target = 1;
+
+    uint64_t seen = 0;
+    for (int b = 0; b < BUCKET_COUNT; ++b) {
+        seen += counts[b].load(memory_order_relaxed);
+        if (seen >= target) {
+            uint64_t value = bucketMiddle(b);
+            return value < getMax() ? value : getMax();
+        }
+    }
+    return getMax();
+}
+
+// 평균
+double PhaseHistogram::mean() const {
+    uint64_t count = getCount();
+    return count ? static_cast<double>(sum.load(memory_order_relaxed)) / count : 0.0;
+}
+
+// 초기화
+void PhaseHistogram::clear() {
+    for (int b = 0; b < BUCKET_COUNT; ++b) counts[b].store(0, memory_order_relaxed);
+    total.store(0, memory_order_relaxed);
+    sum.store(0, memory_order_relaxed);
+    maximum.store(0, memory_order_relaxed);
+}
+
+PhaseHistogram& phaseHistogram(ProfilePhase phase) {
+    return histograms[phase];
+}
+
+void setProfilerEnabled(bool enabled) {
+    profilerActive.store(enabled, memory_order_relaxed);
+}
+
+void clearProfile() {
+    for (int p = 0; p < PHASE_COUNT; ++p) histograms[p].clear();
+}
+
+// 단계별 표 (ns)
+void writeProfile(FILE* out) {
+    fprintf(out, "%-12s %10s %10s %10s %10s %10s\n", "phase", "count", "mean_ns", "p50_ns", "p99_ns", "max_ns");
+    for (int p = 0; p < PHASE_COUNT; ++p) {
+        const PhaseHistogram& h = histograms[p];
+        fprintf(out, "%-12s %10llu %10.0f %10llu %10llu %10llu\n", profilePhaseName(static_cast<ProfilePhase>(p)),
+                static_cast<unsigned long long>(h.getCount()), h.mean(),
+                static_cast<unsigned long long>(h.percentile(0.5)), static_cast<unsigned long long>(h.percentile(0.99)),
+                static_cast<unsigned long long>(h.getMax()));
+    }
+}
+
+// 파일로 저장
+bool saveProfile(const string& path) {
+    FILE* out = fopen(path.c_str(), "w");
+    if (!out) return false;
+    writeProfile(out);
+    return fclose(out) == 0;
+}
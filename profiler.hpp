@@ -0,0 +1,122 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+
+using namespace std;
+
+// 단계별 프로파일러 - 화면 루프와 시뮬레이션 틱의 각 단계 시간을 히스토그램으로 모음
+// SNAKE_PROFILE이 정의되지 않으면 (make PROFILE=0) PROFILE_SCOPE는 아무 코드도 만들지 않음
+// 정의되어 있어도 setProfilerEnabled(true) 전까지는 원자 변수 하나만 읽고 지나감
+
+// 측정 단계
+enum ProfilePhase {
+    PHASE_INPUT,       // StageController::handleInput
+    PHASE_STEP,        // StageController::tick (입력 적용 + GameState::step)
+    PHASE_RENDER,      // 화면 버퍼에 그리기
+    PHASE_OUTPUT,      // doupdate - 터미널 출력
+    PHASE_SIM_TICK,    // GameState::tick 전체
+    PHASE_SIM_TIMERS,  // 타이머 처리 (아이템 만료, 게이트, 바람개비, 시간 초과)
+    PHASE_SIM_ITEMS,   // distributeItems
+    PHASE_AUTOPILOT,   // Autopilot::decide
+    PHASE_MCTS,        // MctsPlayer::decide (롤아웃의 시뮬레이션 단계도 따로 잡힘)
+    PHASE_COUNT
+};
+
+// 단계 이름
+const char* profilePhaseName(ProfilePhase phase);
+
+// PhaseHistogram 클래스 - 잠금 없는 로그 구간 히스토그램 (ns 단위)
+// 2의 거듭제곱 구간마다 8칸으로 나눠 상대 오차 12.5% 이내, 기록은 relaxed 원자 연산만 씀
+class PhaseHistogram {
+public:
+    static const int SUB_BUCKETS = 8;
+    static const int BUCKET_COUNT = 38 * SUB_BUCKETS;  // 2^40 ns(약 18분)까지
+
+    PhaseHistogram() { clear(); }
+
+    // 측정값 하나 기록 - 여러 스레드에서 동시에 불러도 됨
+    void record(uint64_t ns) {
+        counts[bucketFor(ns)].fetch_add(1, memory_order_relaxed);
+        total.fetch_add(1, memory_order_relaxed);
+        sum.fetch_add(ns, memory_order_relaxed);
+        uint64_t seen = maximum.load(memory_order_relaxed);
+        while (ns > seen && !maximum.compare_exchange_weak(seen, ns, memory_order_relaxed)) {}
+    }
+
+    // 분위수 (q = 0.5, 0.99 ...) - 구간 중앙값, 최대값을 넘지 않음
+    uint64_t percentile(double q) const;
+
+    uint64_t getCount() const { return total.load(memory_order_relaxed); }
+    uint64_t getMax() const { return maximum.load(memory_order_relaxed); }
+    double mean() const;
+    void clear();
+
+private:
+    static int bucketFor(uint64_t ns);
+    static uint64_t bucketMiddle(int bucket);
+
+    atomic<uint32_t> counts[BUCKET_COUNT];
+    atomic<uint64_t> total;
+    atomic<uint64_t> sum;
+    atomic<uint64_t> maximum;
+};
+
+// 단계별 히스토그램 (프로세스 전체에서 하나)
+PhaseHistogram& phaseHistogram(ProfilePhase phase);
+
+// 측정 켜기/끄기 - 기본은 꺼짐
+extern atomic<bool> profilerActive;
+void setProfilerEnabled(bool enabled);
+inline bool profilerEnabled() { return profilerActive.load(memory_order_relaxed); }
+
+// 계측 코드가 컴파일되었는지
+inline bool profilerCompiledIn() {
+#ifdef SNAKE_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+// 모든 단계 초기화
+void clearProfile();
+
+// 단계별 표 출력 / 파일로 저장 (실패 시 false)
+void writeProfile(FILE* out);
+bool saveProfile(const string& path);
+
+// ScopedPhaseTimer 클래스 - 범위를 벗어날 때 걸린 시간을 기록함
+class ScopedPhaseTimer {
+public:
+    explicit ScopedPhaseTimer(ProfilePhase phase) : phase(phase), active(profilerEnabled()) {
+        if (active) start = chrono::steady_clock::now();
+    }
+    ~ScopedPhaseTimer() {
+        if (!active) return;
+        auto ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        phaseHistogram(phase).record(static_cast<uint64_t>(ns));
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+    ProfilePhase phase;
+    bool active;
+    chrono::steady_clock::time_point start;
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+#ifdef SNAKE_PROFILE
+#define PROFILE_SCOPE(phase) ScopedPhaseTimer PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,365 @@
+#include "protocol.hpp"
+#include "bytes.hpp"
+#include <algorithm>
+
+const int MAX_HEADS_PER_TICK = 2;   // 한 틱에 이동 + 게이트 통과로 늘어나는 머리 수
+
+// 프레임 쓰기 - 길이는 종류 바이트 포함
+void writeFrame(vector<uint8_t>& out, MessageType type, const vector<uint8_t>& body) {
+    writeVarint(out, body.size() + 1);
+    out.push_back(type);
+    out.insert(out.end(), body.begin(), body.end());
+}
+
+void writeFrame(vector<uint8_t>& out, MessageType type) {
+    writeVarint(out, 1);
+    out.push_back(type);
+}
+
+// 프레임 읽기 - 아직 다 오지 않았으면 FRAME_PARTIAL (pos는 그대로)
+FrameStatus readFrame(const vector<uint8_t>& in, size_t& pos, MessageType& type, size_t& begin, size_t& end,
+                      size_t limit) {
+    size_t p = pos;
+    uint64_t length;
+    if (!readVarint(in, p, length)) return in.size() - pos >= 10 ? FRAME_BAD : FRAME_PARTIAL;
+    if (length == 0 || length > limit) return FRAME_BAD;
+    if (in.size() - p < length) return FRAME_PARTIAL;
+
+    type = static_cast<MessageType>(in[p]);
+    begin = p + 1;
+    end = p + length;
+    pos = end;
+    return FRAME_OK;
+}
+
+bool operator==(const StatusValues& a, const StatusValues& b) {
+    return a.stage == b.stage && equal(a.score, a.score + 5, b.score) && equal(a.mission, a.mission + 6, b.mission);
+}
+
+// 점수판 값 모으기 (미션 완료 여부는 비트로 묶음)
+StatusValues statusOf(const GameState& state) {
+    StatusValues status;
+    status.stage = state.getStageLevel();
+    status.score[0] = state.getSerpent().length();
+    status.score[1] = state.getMaxLength();
+    status.score[2] = state.getGrowScore();
+    status.score[3] = state.getPoisonScore();
+    status.score[4] = state.getGateScore();
+    status.mission[0] = state.getMissionLen();
+    status.mission[1] = state.getMissionMaxLen();
+    status.mission[2] = state.getMissionGrow();
+    status.mission[3] = state.getMissionPoison();
+    status.mission[4] = state.getMissionGate();
+    status.mission[5] = (state.isMissionLenDone() ? 1 : 0) | (state.isMissionMaxDone() ? 2 : 0) |
+                        (state.isMissionGrowDone() ? 4 : 0) | (state.isMissionPoisonDone() ? 8 : 0) |
+                        (state.isMissionGateDone() ? 16 : 0);
+    return status;
+}
+
+// 인코더 생성자
+DeltaEncoder::DeltaEncoder(int width, int height)
+    : width(width), height(height), terrain(width * height, CELL_EMPTY), sentHead(-1), sentLength(0),
+      sentOver(false) {
+    sentStatus = StatusValues();
+}
+
+// 점수판 쓰기
+void DeltaEncoder::writeStatus(const StatusValues& status) {
+    body.push_back(static_cast<uint8_t>(status.stage));
+    for (int value : status.score) writeVarint(body, static_cast<uint64_t>(value));
+    for (int value : status.mission) writeVarint(body, static_cast<uint64_t>(value));
+}
+
+// 전체 상태 - 지형은 같은 값이 이어지는 구간(런)으로 묶음
+void DeltaEncoder::encodeSnapshot(GameState& state, vector<uint8_t>& out) {
+    const StageMap& map = state.getMap();
+    const Serpent& serpent = state.getSerpent();
+    int cells = width * height;
+
+    body.clear();
+    writeFixed(body, width, 2);
+    writeFixed(body, height, 2);
+    writeVarint(body, static_cast<uint64_t>(state.getStageTicks()));
+
+    for (int i = 0; i < cells;) {
+        uint8_t value = map.atIndex(i);
+        int run = 1;
+        while (i + run < cells && map.atIndex(i + run) == value) ++run;
+        writeVarint(body, static_cast<uint64_t>(run));
+        body.push_back(value);
+        fill(terrain.begin() + i, terrain.begin() + i + run, value);
+        i += run;
+    }
+
+    writeVarint(body, static_cast<uint64_t>(serpent.length()));
+    for (int k = 0; k < serpent.length(); ++k) {
+        PackedCell cell = serpent.segmentAt(k);
+        writeVarint(body, static_cast<uint64_t>(map.index(cellX(cell), cellY(cell))));
+    }
+    auto head = serpent.getHeadPosition();
+    sentHead = map.index(head.first, head.second);
+    sentLength = serpent.length();
+
+    sentStatus = statusOf(state);
+    writeStatus(sentStatus);
+    body.push_back(static_cast<uint8_t>(state.getOverReason()));
+    sentOver = state.isOver();
+
+    state.clearDamage();
+    writeFrame(out, MSG_SNAPSHOT, body);
+}
+
+// 한 틱의 변화 - 머리/꼬리는 지난번 머리 위치로, 지형은 변경 칸 목록과 보낸 지형을 비교해서 구함
+void DeltaEncoder::encodeTick(GameState& state, bool stamped, uint64_t timestampNs, vector<uint8_t>& out) {
+    if (state.needsFullRedraw()) {
+        encodeSnapshot(state, out);
+        return;
+    }
+
+    const StageMap& map = state.getMap();
+    const Serpent& serpent = state.getSerpent();
+    int length = serpent.length();
+
+    // 지난번 머리가 지금 몇 번째 칸인지 = 새로 생긴 머리 수
+    int added = -1;
+    for (int k = 0; k < length && k <= MAX_HEADS_PER_TICK; ++k) {
+        PackedCell cell = serpent.segmentAt(k);
+        if (map.index(cellX(cell), cellY(cell)) == sentHead) {
+            added = k;
+            break;
+        }
+    }
+    int removed = sentLength + added - length;
+    if (added < 0 || removed < 0) {
+        encodeSnapshot(state, out);
+        return;
+    }
+
+    body.clear();
+    if (stamped) writeFixed(body, timestampNs, 8);
+
+    for (int k = added - 1; k >= 0; --k) {
+        PackedCell cell = serpent.segmentAt(k);
+        body.push_back(OP_HEAD);
+        writeVarint(body, static_cast<uint64_t>(map.index(cellX(cell), cellY(cell))));
+    }
+    if (removed > 0) {
+        body.push_back(OP_TAIL);
+        writeVarint(body, static_cast<uint64_t>(removed));
+    }
+    if (added > 0) {
+        PackedCell head = serpent.segmentAt(0);
+        sentHead = map.index(cellX(head), cellY(head));
+    }
+    sentLength = length;
+
+    // 변경 칸 중 지형이 바뀐 칸만 (뱀이 지나간 칸은 위의 머리/꼬리로 충분함)
+    for (int index : state.getDirtyCells()) {
+        uint8_t value = map.atIndex(index);
+        if (value == terrain[index]) continue;
+        terrain[index] = value;
+        body.push_back(OP_CELL);
+        writeVarint(body, static_cast<uint64_t>(index));
+        body.push_back(value);
+    }
+
+    StatusValues status = statusOf(state);
+    if (status != sentStatus) {
+        sentStatus = status;
+        body.push_back(OP_SCORES);
+        writeStatus(status);
+    }
+
+    if (state.isOver() && !sentOver) {
+        sentOver = true;
+        body.push_back(OP_OVER);
+        body.push_back(static_cast<uint8_t>(state.getOverReason()));
+    }
+
+    state.clearDamage();
+    writeFrame(out, MSG_TICK, body);
+}
+
+// 맵 크기에 맞춰 버퍼 할당
+void SnakeMirror::resize(int newWidth, int height) {
+    width = newWidth;
+    body.assign(width * height + 1, 0);
+    occupancy.assign(width * height, 0);
+    headIndex = 0;
+    count = 0;
+}
+
+// 몸통 비우기
+void SnakeMirror::clear() {
+    while (count > 0) popTail();
+    headIndex = 0;
+}
+
+// 머리 추가
+void SnakeMirror::pushHead(int cell) {
+    int capacity = static_cast<int>(body.size());
+    headIndex = (headIndex == 0) ? capacity - 1 : headIndex - 1;
+    body[headIndex] = cell;
+    ++count;
+    ++occupancy[cell];
+}
+
+// 꼬리 제거
+void SnakeMirror::popTail() {
+    --count;
+    --occupancy[segmentAt(count)];
+}
+
+// 진행 방향 - 머리와 목이 붙어 있지 않으면(게이트 통과 직후) 오른쪽으로 봄
+Direction SnakeMirror::getCurrentDirection() const {
+    if (count < 2) return RIGHT;
+    int head = segmentAt(0);
+    int neck = segmentAt(1);
+    if (head == neck - width) return UP;
+    if (head == neck + width) return DOWN;
+    if (head == neck - 1) return LEFT;
+    return RIGHT;
+}
+
+// 미러 생성자 - 첫 SNAPSHOT 전에는 빈 상태
+BoardMirror::BoardMirror()
+    : width(0), height(0), map(0, 0), stageTicks(0), ticks(0), stamped(false), lastTimestamp(0),
+      overReason(OVER_NONE), fullRedraw(true) {
+    status = StatusValues();
+}
+
+// 서버 프레임 적용
+bool BoardMirror::apply(MessageType type, const vector<uint8_t>& in, size_t begin, size_t end) {
+    switch (type) {
+        case MSG_SNAPSHOT: return applySnapshot(in, begin, end);
+        case MSG_TICK:     return hasBoard() && applyTick(in, begin, end);
+        default:           return false;
+    }
+}
+
+// 점수판 읽기
+bool BoardMirror::readStatus(const vector<uint8_t>& in, size_t& pos, size_t end) {
+    if (pos >= end) return false;
+    status.stage = in[pos++];
+    uint64_t value;
+    for (int& score : status.score) {
+        if (!readVarint(in, pos, end, value)) return false;
+        score = static_cast<int>(value);
+    }
+    for (int& mission : status.mission) {
+        if (!readVarint(in, pos, end, value)) return false;
+        mission = static_cast<int>(value);
+    }
+    return true;
+}
+
+// 전체 상태 적용 - 크기가 같으면 버퍼를 재사용함
+bool BoardMirror::applySnapshot(const vector<uint8_t>& in, size_t pos, size_t end) {
+    if (end - pos < 4) return false;
+    int newWidth = static_cast<int>(readFixed(in, pos, 2));
+    int newHeight = static_cast<int>(readFixed(in, pos + 2, 2));
+    pos += 4;
+    if (newWidth <= 0 || newHeight <= 0 || static_cast<long>(newWidth) * newHeight > MAX_BOARD_CELLS) return false;
+
+    clearDamage();
+    if (newWidth != width || newHeight != height) {
+        width = newWidth;
+        height = newHeight;
+        map = StageMap(width, height);
+        serpent.resize(width, height);
+        dirtyMark.assign(width * height, 0);
+    }
+
+    uint64_t value;
+    if (!readVarint(in, pos, end, value)) return false;
+    stageTicks = static_cast<int>(value);
+
+    int cells = width * height;
+    for (int i = 0; i < cells;) {
+        uint64_t run;
+        if (!readVarint(in, pos, end, run) || pos >= end || run == 0 || run > static_cast<uint64_t>(cells - i)) {
+            return false;
+        }
+        Cell cell = static_cast<Cell>(in[pos++]);
+        for (uint64_t k = 0; k < run; ++k) map.setIndex(i++, cell);
+    }
+
+    // 몸통은 머리부터 오므로 꼬리부터 넣음
+    uint64_t length;
+    if (!readVarint(in, pos, end, length) || length > static_cast<uint64_t>(cells)) return false;
+    vector<int> segments(length);
+    for (uint64_t k = 0; k < length; ++k) {
+        if (!readVarint(in, pos, end, value) || !validCell(value)) return false;
+        segments[k] = static_cast<int>(value);
+    }
+    serpent.clear();
+    for (size_t k = segments.size(); k-- > 0;) serpent.pushHead(segments[k]);
+
+    if (!readStatus(in, pos, end) || pos >= end || in[pos] > OVER_SNAKE) return false;
+    overReason = static_cast<GameOverReason>(in[pos++]);
+    fullRedraw = true;
+    return pos == end;
+}
+
+// 한 틱의 변화 적용
+bool BoardMirror::applyTick(const vector<uint8_t>& in, size_t pos, size_t end) {
+    if (stamped) {
+        if (end - pos < 8) return false;
+        lastTimestamp = readFixed(in, pos, 8);
+        pos += 8;
+    }
+    ++ticks;
+    ++stageTicks;
+
+    uint64_t value;
+    while (pos < end) {
+        switch (in[pos++]) {
+            case OP_HEAD:
+                if (!readVarint(in, pos, end, value) || !validCell(value)) return false;
+                serpent.pushHead(static_cast<int>(value));
+                markDirty(static_cast<int>(value));
+                break;
+
+            case OP_TAIL:
+                if (!readVarint(in, pos, end, value) || value > static_cast<uint64_t>(serpent.length())) return false;
+                for (uint64_t k = 0; k < value; ++k) {
+                    markDirty(serpent.segmentAt(serpent.length() - 1));
+                    serpent.popTail();
+                }
+                break;
+
+            case OP_CELL:
+                if (!readVarint(in, pos, end, value) || !validCell(value) || pos >= end) return false;
+                map.setIndex(static_cast<int>(value), static_cast<Cell>(in[pos++]));
+                markDirty(static_cast<int>(value));
+                break;
+
+            case OP_SCORES:
+                if (!readStatus(in, pos, end)) return false;
+                break;
+
+            case OP_OVER:
+                if (pos >= end || in[pos] > OVER_SNAKE) return false;
+                overReason = static_cast<GameOverReason>(in[pos++]);
+                break;
+
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+// 변경 칸 기록
+void BoardMirror::markDirty(int cell) {
+    if (dirtyMark[cell]) return;
+    dirtyMark[cell] = 1;
+    dirtyCells.push_back(cell);
+}
+
+// 변경 칸 목록 비우기 - 화면에 반영한 뒤 호출
+void BoardMirror::clearDamage() {
+    for (int index : dirtyCells) dirtyMark[index] = 0;
+    dirtyCells.clear();
+    fullRedraw = false;
+}
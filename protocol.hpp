@@ -0,0 +1,178 @@
+#ifndef PROTOCOL_HPP
+#define PROTOCOL_HPP
+
+#include "simulation.hpp"
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// 서버-클라이언트 프로토콜 (리틀 엔디언)
+//   프레임: 길이(varint, 종류 포함) | 종류(u8) | 본문
+//   클라이언트 -> 서버
+//     HELLO    버전(u8) | 플래그(u8)
+//     INPUT    입력(u8, Action)
+//     RESTART  (게임 오버 뒤 새 게임)
+//   서버 -> 클라이언트
+//     SNAPSHOT width(u16) | height(u16) | 스테이지 틱(varint) | 지형 런(개수 varint + 값 u8 ...)
+//              | 뱀 길이(varint) | 몸통 칸 번호(varint ..., 머리부터) | 점수판 | 게임 오버 사유(u8)
+//     TICK     [서버 시각 ns(u64), HELLO_TIMESTAMPS일 때만] | 변화 ...
+//   TICK의 변화 - 바뀐 것만 보냄 (아무 일 없는 틱은 프레임 3바이트)
+//     HEAD   칸 번호(varint)         머리 추가
+//     TAIL   개수(varint)            꼬리 제거
+//     CELL   칸 번호(varint) | 값(u8) 지형 변경 (아이템 생성/만료, 게이트 이동, 바람개비 날)
+//     SCORES 점수판                  점수/미션 변경
+//     OVER   사유(u8)                게임 오버
+//   점수판: 스테이지(u8) | 점수 5개(varint) | 미션 6개(varint)
+const uint8_t PROTOCOL_VERSION = 1;
+const uint8_t HELLO_TIMESTAMPS = 1;          // TICK마다 서버 시각을 붙임 (지연 측정용)
+const size_t MAX_FRAME_BYTES = 64u << 20;    // 서버 -> 클라이언트 - 4096x4096 맵 스냅샷도 들어가는 크기
+const size_t MAX_CLIENT_FRAME_BYTES = 16;    // 클라이언트 -> 서버 - HELLO/INPUT/RESTART 본문은 2바이트 이하
+
+// 메시지 종류
+enum MessageType : uint8_t {
+    MSG_HELLO = 1,
+    MSG_INPUT = 2,
+    MSG_RESTART = 3,
+    MSG_SNAPSHOT = 16,
+    MSG_TICK = 17
+};
+
+// TICK 안의 변화 종류
+enum DeltaOp : uint8_t {
+    OP_HEAD = 1,
+    OP_TAIL = 2,
+    OP_CELL = 3,
+    OP_SCORES = 4,
+    OP_OVER = 5
+};
+
+// 프레임 해석 결과
+enum FrameStatus { FRAME_OK, FRAME_PARTIAL, FRAME_BAD };
+
+// 프레임 하나 쓰기 - body는 종류 뒤의 본문
+void writeFrame(vector<uint8_t>& out, MessageType type, const vector<uint8_t>& body);
+void writeFrame(vector<uint8_t>& out, MessageType type);
+
+// pos에서 프레임 하나 읽기 - FRAME_OK이면 본문은 in[begin, end), pos는 다음 프레임으로
+// 길이가 limit(종류 바이트 포함)를 넘으면 본문을 기다리지 않고 FRAME_BAD
+FrameStatus readFrame(const vector<uint8_t>& in, size_t& pos, MessageType& type, size_t& begin, size_t& end,
+                      size_t limit = MAX_FRAME_BYTES);
+
+// 점수판 값 - 화면의 점수/미션 창과 프로토콜이 같은 묶음을 씀
+struct StatusValues {
+    int stage;
+    int score[5];    // 길이, 최대 길이, 성장, 독, 게이트
+    int mission[6];  // 목표 길이, 목표 최대 길이, 성장, 독, 게이트, 완료 비트
+};
+
+bool operator==(const StatusValues& a, const StatusValues& b);
+inline bool operator!=(const StatusValues& a, const StatusValues& b) { return !(a == b); }
+
+StatusValues statusOf(const GameState& state);
+
+// DeltaEncoder 클래스 - 서버 쪽 세션별 인코더
+// 마지막으로 보낸 지형/머리/길이/점수판을 기억해 두고 GameState의 변경 칸 목록과 비교해 변화만 보냄
+// GameState는 setDamageTracking(true)여야 함
+class DeltaEncoder {
+public:
+    DeltaEncoder(int width, int height);
+
+    // 전체 상태 프레임 - 새 세션이나 스테이지가 바뀐 뒤
+    void encodeSnapshot(GameState& state, vector<uint8_t>& out);
+
+    // 한 틱의 변화 프레임 - 설명할 수 없는 변화(스테이지 전환 등)면 스냅샷을 대신 보냄
+    void encodeTick(GameState& state, bool stamped, uint64_t timestampNs, vector<uint8_t>& out);
+
+private:
+    void writeStatus(const StatusValues& status);
+
+    int width, height;
+    vector<uint8_t> terrain;     // 클라이언트가 가진 지형
+    int sentHead;                // 클라이언트가 가진 머리 칸
+    int sentLength;              // 클라이언트가 가진 뱀 길이
+    StatusValues sentStatus;
+    bool sentOver;
+    vector<uint8_t> body;        // 프레임 본문 (재사용)
+};
+
+// SnakeMirror 클래스 - 클라이언트 쪽 뱀 (Serpent와 같은 조회 함수)
+class SnakeMirror {
+public:
+    SnakeMirror() : width(0), headIndex(0), count(0) {}
+
+    void resize(int width, int height);
+    void clear();
+    void pushHead(int cell);
+    void popTail();
+
+    int length() const { return count; }
+    int segmentAt(int i) const { return body[(headIndex + i) % body.size()]; }
+    bool occupiesIndex(int index) const { return occupancy[index] != 0; }
+    pair<int, int> getHeadPosition() const {
+        int head = count > 0 ? body[headIndex] : 0;
+        return { head % width, head / width };
+    }
+    Direction getCurrentDirection() const;   // 머리와 목 위치로 계산
+
+private:
+    int width;
+    vector<int> body;            // 칸 번호 링 버퍼 (맵 넓이 + 1)
+    int headIndex;
+    int count;
+    vector<uint8_t> occupancy;   // 칸별 몸통 개수
+};
+
+// BoardMirror 클래스 - 클라이언트 쪽 상태, 서버 프레임을 적용해 GameState와 같은 조회 함수로 보여 줌
+// 화면 코드(BoardPainter)가 로컬 GameState와 같은 방식으로 그릴 수 있음
+class BoardMirror {
+public:
+    BoardMirror();
+
+    // 서버 프레임 하나 적용 - 형식이 틀리면 false
+    bool apply(MessageType type, const vector<uint8_t>& in, size_t begin, size_t end);
+
+    bool hasBoard() const { return width > 0; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    const StageMap& getMap() const { return map; }
+    const SnakeMirror& getSerpent() const { return serpent; }
+    const StatusValues& getStatus() const { return status; }
+    int getStageTicks() const { return stageTicks; }
+    long getTickCount() const { return ticks; }
+    uint64_t getLastTimestamp() const { return lastTimestamp; }
+    void setTimestamps(bool enabled) { stamped = enabled; }
+
+    bool isOver() const { return overReason != OVER_NONE; }
+    bool isCleared() const { return overReason == OVER_CLEARED; }
+    GameOverReason getOverReason() const { return overReason; }
+
+    // 화면 갱신용 변경 칸 (GameState와 같음)
+    const vector<int>& getDirtyCells() const { return dirtyCells; }
+    bool needsFullRedraw() const { return fullRedraw; }
+    void clearDamage();
+
+private:
+    bool applySnapshot(const vector<uint8_t>& in, size_t pos, size_t end);
+    bool applyTick(const vector<uint8_t>& in, size_t pos, size_t end);
+    bool readStatus(const vector<uint8_t>& in, size_t& pos, size_t end);
+    bool validCell(uint64_t cell) const { return cell < static_cast<uint64_t>(width) * height; }
+    void markDirty(int cell);
+
+    int width, height;
+    StageMap map;
+    SnakeMirror serpent;
+    StatusValues status;
+    int stageTicks;
+    long ticks;                  // 받은 TICK 수
+    bool stamped;                // TICK에 서버 시각이 붙는지 (HELLO 플래그와 같게)
+    uint64_t lastTimestamp;
+    GameOverReason overReason;
+    bool fullRedraw;
+    vector<int> dirtyCells;
+    vector<uint8_t> dirtyMark;
+};
+
+inline const StatusValues& statusOf(const BoardMirror& board) { return board.getStatus(); }
+
+#endif
@@ -0,0 +1,113 @@
+#include "replay.hpp"
+#include "bytes.hpp"
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+// 기록기 생성자
+ReplayRecorder::ReplayRecorder(int width, int height, uint64_t seed)
+    : width(width), height(height), seed(seed), lastTick(0) {}
+
+// 입력 기록 - 직전 이벤트와의 틱 간격만 저장
+void ReplayRecorder::record(long tick, Action action) {
+    if (action == ACT_NONE) return;
+    writeVarint(events, static_cast<uint64_t>(tick - lastTick));
+    events.push_back(static_cast<uint8_t>(action));
+    lastTick = tick;
+}
+
+// 기록 초기화
+void ReplayRecorder::reset(uint64_t newSeed) {
+    events.clear();
+    seed = newSeed;
+    lastTick = 0;
+}
+
+// 파일 저장
+bool ReplayRecorder::save(const string& path, long finalTick) const {
+    vector<uint8_t> out;
+    out.insert(out.end(), { 'S', 'N', 'K', 'R' });
+    out.push_back(REPLAY_VERSION);
+    writeFixed(out, width, 2);
+    writeFixed(out, height, 2);
+    writeFixed(out, seed, 8);
+    out.insert(out.end(), events.begin(), events.end());
+
+    // 끝 표시
+    writeVarint(out, static_cast<uint64_t>(finalTick - lastTick));
+    out.push_back(static_cast<uint8_t>(ACT_NONE));
+
+    ofstream file(path.c_str(), ios::binary);
+    if (!file) return false;
+    file.write(reinterpret_cast<const char*>(out.data()), out.size());
+    return static_cast<bool>(file);
+}
+
+// 재생기 생성자
+ReplayPlayer::ReplayPlayer()
+    : eventsStart(0), cursor(0), width(0), height(0), seed(0),
+      nextTick(0), nextAction(ACT_NONE), finalTick(0) {}
+
+// 파일 읽기
+bool ReplayPlayer::load(const string& path, const LevelPack* pack) {
+    ifstream file(path.c_str(), ios::binary);
+    if (!file) return false;
+    data.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+
+    const size_t headerSize = 4 + 1 + 2 + 2 + 8;
+    if (data.size() < headerSize || memcmp(data.data(), "SNKR", 4) != 0 || data[4] != REPLAY_VERSION) {
+        return false;
+    }
+    width = static_cast<int>(readFixed(data, 5, 2));
+    height = static_cast<int>(readFixed(data, 7, 2));
+    seed = readFixed(data, 9, 8);
+    if (pack) {
+        if (width != pack->getWidth() || height != pack->getHeight()) return false;
+    } else if (width < MIN_BOARD_WIDTH || height < MIN_BOARD_HEIGHT ||
+               static_cast<long>(width) * height > MAX_BOARD_CELLS) {
+        return false;
+    }
+    eventsStart = headerSize;
+
+    // 끝 표시까지 훑어서 마지막 틱을 구함
+    rewind();
+    long tick = 0;
+    size_t pos = eventsStart;
+    while (pos < data.size()) {
+        uint64_t delta;
+        if (!readVarint(data, pos, delta) || pos >= data.size()) return false;
+        tick += static_cast<long>(delta);
+        if (data[pos++] == ACT_NONE) {
+            finalTick = tick;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 다음 이벤트 해석
+bool ReplayPlayer::readEvent() {
+    uint64_t delta;
+    if (!readVarint(data, cursor, delta) || cursor >= data.size()) {
+        nextAction = ACT_NONE;
+        return false;
+    }
+    nextTick += static_cast<long>(delta);
+    nextAction = static_cast<Action>(data[cursor++]);
+    return true;
+}
+
+// 처음부터 다시 재생
+void ReplayPlayer::rewind() {
+    cursor = eventsStart;
+    nextTick = 0;
+    readEvent();
+}
+
+// tick번째 입력 반환
+Action ReplayPlayer::next(long tick) {
+    if (tick != nextTick || nextAction == ACT_NONE) return ACT_NONE;
+    Action action = nextAction;
+    readEvent();
+    return action;
+}
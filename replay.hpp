@@ -0,0 +1,73 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "simulation.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+using namespace std;
+
+// 리플레이 파일 형식 (리틀 엔디언)
+//   "SNKR" | 버전(u8) | width(u16) | height(u16) | seed(u64)
+//   이벤트: 틱 간격(varint) + 입력(u8)  ... 입력이 있는 틱만 기록
+//   끝:     마지막 틱까지 간격(varint) + ACT_NONE
+const uint8_t REPLAY_VERSION = 1;
+
+// ReplayRecorder 클래스 - 시드와 틱별 입력 변화를 메모리에 기록함
+class ReplayRecorder {
+public:
+    ReplayRecorder(int width, int height, uint64_t seed);
+
+    // tick번째 step()에 들어간 입력 기록 (ACT_NONE은 기록하지 않음)
+    void record(long tick, Action action);
+
+    // 새 게임 기록 시작 - 버퍼 할당은 재사용
+    void reset(uint64_t newSeed);
+
+    // 마지막 틱과 함께 파일로 저장 - 실패 시 false
+    bool save(const string& path, long finalTick) const;
+
+private:
+    vector<uint8_t> events;  // 인코딩된 이벤트
+    int width, height;
+    uint64_t seed;
+    long lastTick;           // 마지막으로 기록한 틱
+};
+
+// ReplayPlayer 클래스 - 리플레이 파일을 읽어 틱 순서대로 입력을 돌려줌
+class ReplayPlayer {
+public:
+    ReplayPlayer();
+
+    // 파일 읽기 - 형식이 맞지 않거나 맵 크기가 허용 범위(pack이 있으면 그 크기)를 벗어나면 false
+    bool load(const string& path, const LevelPack* pack = nullptr);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    uint64_t getSeed() const { return seed; }
+    long getFinalTick() const { return finalTick; }
+
+    // tick번째 step()에 넣을 입력 - tick은 0부터 차례로 증가해야 함
+    Action next(long tick);
+
+    // 기록된 마지막 틱까지 재생했는지
+    bool finished(long tick) const { return tick >= finalTick; }
+
+    // 처음부터 다시 재생
+    void rewind();
+
+private:
+    bool readEvent();  // 다음 이벤트 해석
+
+    vector<uint8_t> data;
+    size_t eventsStart;      // 이벤트 시작 위치
+    size_t cursor;           // 현재 읽는 위치
+    int width, height;
+    uint64_t seed;
+    long nextTick;           // 다음 이벤트의 틱
+    Action nextAction;       // 다음 이벤트의 입력
+    long finalTick;          // 기록된 마지막 틱
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef RNG_HPP
+#define RNG_HPP
+
+#include <cstdint>
+
+// Rng 클래스 - 게임 상태가 직접 소유하는 시드 고정 난수 생성기 (PCG32)
+// 같은 시드면 어떤 플랫폼에서도 같은 수열을 만듦
+class Rng {
+public:
+    explicit Rng(uint64_t seed = 0) { reseed(seed); }
+
+    // 시드 재설정
+    void reseed(uint64_t seed) {
+        state = 0;
+        inc = (seed << 1) | 1u;
+        next();
+        state += seed;
+        next();
+    }
+
+    // 32비트 난수
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + inc;
+        uint32_t xorshifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = static_cast<uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
+
+    // [0, bound) 범위 정수 - 곱셈 후 상위 비트 사용
+    int below(int bound) {
+        return static_cast<int>((static_cast<uint64_t>(next()) * static_cast<uint32_t>(bound)) >> 32);
+    }
+
+    // 스냅샷/복원용 내부 상태
+    uint64_t getState() const { return state; }
+    uint64_t getIncrement() const { return inc; }
+    void restore(uint64_t savedState, uint64_t savedInc) {
+        state = savedState;
+        inc = savedInc;
+    }
+
+private:
+    uint64_t state;
+    uint64_t inc;
+};
+
+#endif
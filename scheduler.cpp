@@ -0,0 +1,64 @@
+#include "scheduler.hpp"
+#include <thread>
+
+// 생성자
+FixedStepScheduler::FixedStepScheduler(int stepMs, int maxCatchUp)
+    : step(chrono::milliseconds(stepMs)), maxCatchUp(maxCatchUp),
+      lastTime(Clock::now()), accumulator(Clock::duration::zero()),
+      stepCount(0), droppedSteps(0), jitterSamples(0), jitterSumMs(0.0), jitterMaxMs(0.0) {}
+
+// 시계 기준점 설정
+void FixedStepScheduler::start() {
+    lastTime = Clock::now();
+    accumulator = Clock::duration::zero();
+}
+
+// 경과 시간을 누적하고 실행할 틱 수 계산
+int FixedStepScheduler::collectSteps() {
+    Clock::time_point now = Clock::now();
+    accumulator += now - lastTime;
+    lastTime = now;
+
+    int steps = 0;
+    while (accumulator >= step) {
+        accumulator -= step;
+        ++steps;
+    }
+    if (steps == 0) return 0;
+
+    // 남은 누적 시간 = 마지막 틱이 예정보다 늦은 정도
+    double lateMs = chrono::duration<double, milli>(accumulator).count();
+    jitterSumMs += lateMs;
+    if (lateMs > jitterMaxMs) jitterMaxMs = lateMs;
+    ++jitterSamples;
+
+    // 너무 밀린 경우 따라잡지 않고 버림
+    if (steps > maxCatchUp) {
+        droppedSteps += steps - maxCatchUp;
+        steps = maxCatchUp;
+    }
+    stepCount += steps;
+    return steps;
+}
+
+// 다음 틱 시각까지 대기
+void FixedStepScheduler::waitForNextStep() const {
+    this_thread::sleep_until(lastTime + (step - accumulator));
+}
+
+// 다음 틱까지 남은 시간(ms)
+int FixedStepScheduler::msUntilNextStep() const {
+    Clock::duration left = lastTime + (step - accumulator) - Clock::now();
+    if (left <= Clock::duration::zero()) return 0;
+    return static_cast<int>((chrono::duration_cast<chrono::microseconds>(left).count() + 999) / 1000);
+}
+
+// 평균 지터(ms)
+double FixedStepScheduler::meanJitterMs() const {
+    return jitterSamples > 0 ? jitterSumMs / jitterSamples : 0.0;
+}
+
+// 최대 지터(ms)
+double FixedStepScheduler::maxJitterMs() const {
+    return jitterMaxMs;
+}
@@ -0,0 +1,47 @@
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+
+#include <chrono>
+
+using namespace std;
+
+// FixedStepScheduler 클래스 - 고정 간격 시뮬레이션 틱과 화면 갱신을 분리함
+// 단조 시계의 경과 시간을 누적기에 쌓고, 누적된 만큼만 틱을 실행함
+class FixedStepScheduler {
+public:
+    typedef chrono::steady_clock Clock;
+
+    // 생성자 - 틱 간격(ms)과 한 번에 따라잡을 최대 틱 수
+    FixedStepScheduler(int stepMs, int maxCatchUp);
+
+    // 시계 기준점 설정
+    void start();
+
+    // 지금까지 쌓인 시간으로 실행할 틱 수 반환
+    int collectSteps();
+
+    // 다음 틱 시각까지 대기
+    void waitForNextStep() const;
+
+    // 다음 틱 시각까지 남은 시간(ms, 올림) - 이벤트 대기 시간 제한용
+    int msUntilNextStep() const;
+
+    // 지터 통계 - 틱이 예정 시각보다 늦게 실행된 정도
+    long getStepCount() const { return stepCount; }
+    long getDroppedSteps() const { return droppedSteps; }
+    double meanJitterMs() const;
+    double maxJitterMs() const;
+
+private:
+    Clock::duration step;          // 틱 간격
+    int maxCatchUp;                // 한 번에 실행할 최대 틱 수
+    Clock::time_point lastTime;    // 마지막 측정 시각
+    Clock::duration accumulator;   // 아직 실행하지 않은 시간
+    long stepCount;                // 실행한 틱 수
+    long droppedSteps;             // 너무 밀려서 버린 틱 수
+    long jitterSamples;            // 지터 측정 횟수
+    double jitterSumMs;            // 지터 합계
+    double jitterMaxMs;            // 지터 최대값
+};
+
+#endif
@@ -1,80 +1,110 @@
 #include "serpent.hpp"
-#include <ncurses.h>
-#include <iostream>
+#include "bytes.hpp"
 
 // 생성자 - 초기 위치에 몸통 구성을 함
-Serpent::Serpent(int startX, int startY)
-    : currentDir(RIGHT), pendingGrowth(false),
-      prevMoveTime(chrono::steady_clock::now()),
-      intervalSec(0.2f), isBoosted(false), isSlowed(false) {
-    segments.push_back({ startX, startY });
-    segments.push_back({ startX - 1, startY });
-    segments.push_back({ startX - 2, startY });
-}
-
-// 상태 갱신 - 일정 시간 간격마다 이동
-void Serpent::refresh() {
-    auto now = chrono::steady_clock::now();
-    chrono::duration<float> elapsed = now - prevMoveTime;
-
-    // 속도 변경 상태가 지속되면 일정 시간 후 복구
-    if (isBoosted || isSlowed) {
-        chrono::duration<float> durationSinceSpeedChange = now - speedAdjustedAt;
-        if (durationSinceSpeedChange.count() >= 5.0f) {
-            intervalSec = 0.2f;
-            isBoosted = false;
-            isSlowed = false;
-        }
-    }
+Serpent::Serpent(int startX, int startY, int width, int height)
+    : width(width), height(height), capacity(width * height + 1), body(capacity),
+      headIndex(0), count(0), occupancy(width * height, 0), currentDir(RIGHT), pendingGrowth(false), ticksSinceMove(0),
+      intervalTicks(BASE_INTERVAL), isBoosted(false), isSlowed(false) {
+    reset(startX, startY);
+}
+
+// 초기 상태로 되돌림 - 버퍼는 재사용하고 차지하던 칸만 지움
+void Serpent::reset(int startX, int startY, Direction dir) {
+    while (count > 0) popTail();
+    headIndex = 0;
+    currentDir = dir;
+    pendingGrowth = false;
+    ticksSinceMove = 0;
+    intervalTicks = BASE_INTERVAL;
+    isBoosted = false;
+    isSlowed = false;
+
+    int dx = (dir == RIGHT) ? 1 : (dir == LEFT) ? -1 : 0;
+    int dy = (dir == DOWN) ? 1 : (dir == UP) ? -1 : 0;
+    pushHead(packCell(startX - 2 * dx, startY - 2 * dy));
+    pushHead(packCell(startX - dx, startY - dy));
+    pushHead(packCell(startX, startY));
+}
+
+// 머리 추가 - 링 버퍼 앞쪽에 기록
+void Serpent::pushHead(PackedCell cell) {
+    headIndex = (headIndex == 0) ? capacity - 1 : headIndex - 1;
+    body.write(headIndex) = cell;
+    ++count;
+    markCell(cell);
+}
+
+// 꼬리 제거
+void Serpent::popTail() {
+    --count;
+    int tail = headIndex + count;
+    if (tail >= capacity) tail -= capacity;
+    unmarkCell(body[tail]);
+}
 
+// 점유 칸 추가 - 맵 밖 좌표는 무시
+void Serpent::markCell(PackedCell cell) {
+    int x = cellX(cell), y = cellY(cell);
+    if (x >= width || y >= height) return;
+    ++occupancy.write(y * width + x);
+}
+
+// 점유 칸 제거
+void Serpent::unmarkCell(PackedCell cell) {
+    int x = cellX(cell), y = cellY(cell);
+    if (x >= width || y >= height) return;
+    --occupancy.write(y * width + x);
+}
+
+// 상태 갱신 - 한 틱 진행, 이동 간격마다 이동
+bool Serpent::refresh() {
     // 이동 타이밍 도달 시 이동
-    if (elapsed.count() >= intervalSec) {
+    if (++ticksSinceMove >= intervalTicks) {
         advance();
-        prevMoveTime = now;
+        ticksSinceMove = 0;
+        return true;
     }
+    return false;
+}
+
+// 다음 refresh()에서 이동하는지
+bool Serpent::movesOnNextRefresh() const {
+    return ticksSinceMove + 1 >= intervalTicks;
 }
 
 // 이동 수행 - 현재 방향 기준으로 한 칸 이동
 void Serpent::advance() {
-    auto head = segments.front();
+    PackedCell head = body[headIndex];
+    int x = cellX(head), y = cellY(head);
 
     switch (currentDir) {
-        case UP:    head.second--; break;
-        case DOWN:  head.second++; break;
-        case LEFT:  head.first--;  break;
-        case RIGHT: head.first++;  break;
+        case UP:    y--; break;
+        case DOWN:  y++; break;
+        case LEFT:  x--; break;
+        case RIGHT: x++; break;
     }
 
-    segments.push_front(head);
+    pushHead(packCell(x, y));
 
     if (!pendingGrowth) {
-        segments.pop_back();
+        popTail();
     } else {
         pendingGrowth = false;
     }
 }
 
-// 방향 변경 요청
-void Serpent::setDirection(Direction newDir) {
-    if (currentDir == newDir) return;
+// 방향 변경 요청 - 역방향 입력은 거부
+bool Serpent::setDirection(Direction newDir) {
+    if (currentDir == newDir) return true;
     if ((currentDir == UP && newDir == DOWN) ||
         (currentDir == DOWN && newDir == UP) ||
         (currentDir == LEFT && newDir == RIGHT) ||
         (currentDir == RIGHT && newDir == LEFT)) {
-        endwin();
-        exit(0);
+        return false;
     }
     currentDir = newDir;
-}
-
-// 몸통 정보 반환
-deque<pair<int, int>> Serpent::getSegments() const {
-    return segments;
-}
-
-// 머리 좌표 반환
-pair<int, int> Serpent::getHeadPosition() const {
-    return segments.front();
+    return true;
 }
 
 // 성장 처리 - 다음 이동 시 꼬리 유지
@@ -84,66 +114,106 @@ void Serpent::extend() {
 
 // 축소 처리 - 꼬리 하나 제거
 void Serpent::shrink() {
-    if (segments.size() > 1) {
-        segments.pop_back();
+    if (count > 1) {
+        popTail();
     }
 }
 
-// 자가 충돌 여부 확인
+// 자가 충돌 여부 확인 - 머리 칸을 둘 이상이 차지하면 충돌
 bool Serpent::detectCollision() const {
-    auto& head = segments.front();
-    for (auto it = ++segments.begin(); it != segments.end(); ++it) {
-        if (*it == head) return true;
-    }
-    return false;
+    PackedCell head = body[headIndex];
+    int x = cellX(head), y = cellY(head);
+    if (x >= width || y >= height) return false;
+    return occupancy[y * width + x] > 1;
 }
 
 // 머리 좌표 및 방향 강제 지정
 void Serpent::assignHead(pair<int, int> newHead, Direction newDir) {
-    segments.push_front(newHead);
+    pushHead(packCell(newHead.first, newHead.second));
     currentDir = newDir;
     if (!pendingGrowth) {
-        segments.pop_back();
+        popTail();
     } else {
         pendingGrowth = false;
     }
 }
 
-// 해당 좌표를 차지하는지 확인
-bool Serpent::occupies(int x, int y) const {
-    for (const auto& segment : segments) {
-        if (segment.first == x && segment.second == y) return true;
-    }
-    return false;
-}
-
 // 현재 방향 반환
 Direction Serpent::getCurrentDirection() const {
     return currentDir;
 }
 
 // 이동 간격 반환
-float Serpent::retrieveInterval() const {
-    return intervalSec;
+int Serpent::retrieveInterval() const {
+    return intervalTicks;
 }
 
 // 이동 간격 설정
-void Serpent::defineInterval(float interval) {
-    intervalSec = interval;
+void Serpent::defineInterval(int interval) {
+    intervalTicks = interval < 1 ? 1 : interval;
 }
 
 // 속도 증가 처리
 void Serpent::boostSpeed() {
-    intervalSec = 0.1f;
-    speedAdjustedAt = chrono::steady_clock::now();
+    intervalTicks = BOOST_INTERVAL;
     isBoosted = true;
     isSlowed = false;
 }
 
 // 속도 감소 처리
 void Serpent::reduceSpeed() {
-    intervalSec = 0.4f;
-    speedAdjustedAt = chrono::steady_clock::now();
+    intervalTicks = SLOW_INTERVAL;
     isBoosted = false;
     isSlowed = true;
 }
+
+// 속도 효과 해제 - 지속 시간은 GameState의 타이머가 관리함
+void Serpent::restoreSpeed() {
+    intervalTicks = BASE_INTERVAL;
+    isBoosted = false;
+    isSlowed = false;
+}
+
+// 스냅샷 저장 - 몸통은 머리부터, 이어서 방향/속도 상태
+void Serpent::save(vector<uint8_t>& out) const {
+    writeVarint(out, static_cast<uint64_t>(count));
+    for (int i = 0; i < count; ++i) writeVarint(out, segmentAt(i));
+    out.push_back(static_cast<uint8_t>(currentDir));
+    out.push_back(static_cast<uint8_t>((pendingGrowth ? 1 : 0) | (isBoosted ? 2 : 0) | (isSlowed ? 4 : 0)));
+    writeVarint(out, static_cast<uint64_t>(ticksSinceMove));
+    writeVarint(out, static_cast<uint64_t>(intervalTicks));
+}
+
+// 스냅샷 복원 - 링 버퍼는 0번부터 다시 채움 (점유 칸도 함께 맞춰짐)
+bool Serpent::load(const vector<uint8_t>& in, size_t& pos, size_t end) {
+    uint64_t length;
+    if (!readVarint(in, pos, end, length) || length == 0 || length >= static_cast<uint64_t>(capacity)) return false;
+    vector<PackedCell> segments(length);
+    for (PackedCell& segment : segments) {
+        uint64_t cell;
+        if (!readVarint(in, pos, end, cell) || cell > 0xFFFFFFFFu) return false;
+        segment = static_cast<PackedCell>(cell);
+        if (cellX(segment) >= width || cellY(segment) >= height) return false;
+    }
+    if (end - pos < 2) return false;
+    uint8_t dir = in[pos++];
+    uint8_t flags = in[pos++];
+    uint64_t sinceMove, interval;
+    if (dir > RIGHT || flags > 7 || !readVarint(in, pos, end, sinceMove) || !readVarint(in, pos, end, interval) ||
+        interval == 0 || interval > 0xFFFF || sinceMove > interval) {
+        return false;
+    }
+
+    // 꼬리부터 머리 쪽으로 넣어야 순서가 유지됨
+    while (count > 0) popTail();
+    headIndex = 0;
+    for (size_t i = segments.size(); i-- > 0;) pushHead(segments[i]);
+
+    currentDir = static_cast<Direction>(dir);
+    pendingGrowth = (flags & 1) != 0;
+    isBoosted = (flags & 2) != 0;
+    isSlowed = (flags & 4) != 0;
+    ticksSinceMove = static_cast<int>(sinceMove);
+    intervalTicks = static_cast<int>(interval);
+    return true;
+}
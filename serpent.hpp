@@ -1,35 +1,109 @@
 #ifndef SNAKE_HPP
 #define SNAKE_HPP
 
-#include <deque>
+#include "cowarray.hpp"
+#include <vector>
 #include <utility>
-#include <chrono>
+#include <cstdint>
 
 using namespace std;
 
 // 방향 열거형 - 뱀의 이동 방향을 설정함
 enum Direction { UP, DOWN, LEFT, RIGHT };
 
+// 이동 간격(틱 단위) - 1틱은 TICK_MS(25ms)
+const int BASE_INTERVAL = 8;    // 기본 속도 (0.2초)
+const int BOOST_INTERVAL = 4;   // 속도 증가 (0.1초)
+const int SLOW_INTERVAL = 16;   // 속도 감소 (0.4초)
+const int SPEED_EFFECT_TICKS = 200;  // 속도 변화 지속 시간 (5초) - GameState 타이머로 해제
+
+// 압축 좌표 - 상위 16비트 y, 하위 16비트 x
+typedef uint32_t PackedCell;
+
+inline PackedCell packCell(int x, int y) {
+    return (static_cast<uint32_t>(y) << 16) | static_cast<uint16_t>(x);
+}
+inline int cellX(PackedCell cell) { return static_cast<int>(cell & 0xFFFF); }
+inline int cellY(PackedCell cell) { return static_cast<int>(cell >> 16); }
+
+// SegmentView - 링 버퍼 위의 몸통을 복사 없이 머리부터 순회하는 뷰
+class SegmentView {
+public:
+    class const_iterator {
+    public:
+        const_iterator(const CowArray<PackedCell>* buf, int capacity, int pos, int visited)
+            : buf(buf), capacity(capacity), pos(pos), visited(visited) {}
+        pair<int, int> operator*() const {
+            PackedCell cell = (*buf)[pos];
+            return { cellX(cell), cellY(cell) };
+        }
+        const_iterator& operator++() {
+            if (++pos == capacity) pos = 0;
+            ++visited;
+            return *this;
+        }
+        bool operator!=(const const_iterator& other) const { return visited != other.visited; }
+        bool operator==(const const_iterator& other) const { return visited == other.visited; }
+
+    private:
+        const CowArray<PackedCell>* buf;
+        int capacity;
+        int pos;
+        int visited;
+    };
+
+    SegmentView(const CowArray<PackedCell>* buf, int capacity, int head, int count)
+        : buf(buf), capacity(capacity), head(head), count(count) {}
+
+    const_iterator begin() const { return const_iterator(buf, capacity, head, 0); }
+    const_iterator end() const { return const_iterator(buf, capacity, head, count); }
+    size_t size() const { return static_cast<size_t>(count); }
+
+private:
+    const CowArray<PackedCell>* buf;
+    int capacity;
+    int head;
+    int count;
+};
+
 // Serpent 클래스 - 게임 내 뱀을 나타냄
 class Serpent {
 public:
-    // 생성자 - 초기 위치 설정
-    Serpent(int startX, int startY);
+    // 생성자 - 초기 위치와 맵 크기 설정
+    Serpent(int startX, int startY, int width, int height);
+
+    // 초기 상태로 되돌림 (할당 없음) - 몸통은 머리 뒤쪽(dir 반대 방향)으로 놓임
+    void reset(int startX, int startY, Direction dir = RIGHT);
 
-    // 상태 갱신 - 이동 주기에 따라 이동 수행
-    void refresh();
+    // 상태 갱신 - 한 틱 진행, 이동했으면 true
+    bool refresh();
+
+    // 다음 refresh()에서 이동하는지 확인
+    bool movesOnNextRefresh() const;
 
     // 이동 수행
     void advance();
 
-    // 방향 설정
-    void setDirection(Direction newDir);
+    // 방향 설정 - 역방향이면 false
+    bool setDirection(Direction newDir);
+
+    // 몸통 정보 반환 (복사 없이 뷰)
+    SegmentView getSegments() const { return SegmentView(&body, capacity, headIndex, count); }
+
+    // 몸통 길이 반환
+    int length() const { return count; }
+
+    // i번째 몸통 좌표 (0 = 머리)
+    PackedCell segmentAt(int i) const { return body[(headIndex + i) % capacity]; }
 
-    // 몸통 정보 반환
-    deque<pair<int, int>> getSegments() const;
+    // 꼬리 좌표 반환
+    PackedCell getTail() const { return segmentAt(count - 1); }
 
     // 머리 좌표 반환
-    pair<int, int> getHeadPosition() const;
+    pair<int, int> getHeadPosition() const {
+        PackedCell head = body[headIndex];
+        return { cellX(head), cellY(head) };
+    }
 
     // 성장 처리
     void extend();
@@ -43,8 +117,14 @@ public:
     // 머리와 방향 설정
     void assignHead(pair<int, int> newHead, Direction newDir);
 
-    // 해당 좌표를 차지하고 있는지 확인
-    bool occupies(int x, int y) const;
+    // 해당 좌표를 차지하고 있는지 확인 (맵 밖은 false)
+    bool occupies(int x, int y) const {
+        if (x < 0 || x >= width || y < 0 || y >= height) return false;
+        return occupancy[y * width + x] != 0;
+    }
+
+    // 칸 번호(y * width + x)로 점유 확인
+    bool occupiesIndex(int index) const { return occupancy[index] != 0; }
 
     // 현재 방향 반환
     Direction getCurrentDirection() const;
@@ -55,19 +135,38 @@ public:
     // 속도 감소
     void reduceSpeed();
 
-    // 이동 간격 설정
-    void defineInterval(float interval);
+    // 속도 효과 해제 (기본 간격으로)
+    void restoreSpeed();
+
+    // 이동 간격 설정 (틱 단위)
+    void defineInterval(int interval);
+
+    // 이동 간격 반환 (틱 단위)
+    int retrieveInterval() const;
+
+    // 다음 이동에서 꼬리가 그대로 남는지 (성장 대기 중)
+    bool growsOnNextMove() const { return pendingGrowth; }
 
-    // 이동 간격 반환
-    float retrieveInterval() const;
+    // 스냅샷 저장/복원 (몸통과 이동 상태) - 맵 크기가 같은 뱀에만 복원함, 형식이 틀리면 false
+    void save(vector<uint8_t>& out) const;
+    bool load(const vector<uint8_t>& in, size_t& pos, size_t end);
 
 private:
-    deque<pair<int, int>> segments;  // 몸통 좌표
+    void pushHead(PackedCell cell);    // 머리 추가
+    void popTail();                    // 꼬리 제거
+    void markCell(PackedCell cell);    // 점유 칸 추가
+    void unmarkCell(PackedCell cell);  // 점유 칸 제거
+
+    int width, height;  // 맵 크기
+    int capacity;  // 링 버퍼 크기 (맵 넓이 + 1)
+    CowArray<PackedCell> body;  // 몸통 링 버퍼
+    int headIndex;  // 머리 위치
+    int count;  // 몸통 길이
+    CowArray<uint8_t> occupancy;  // 칸별 몸통 개수 (y * width + x)
     Direction currentDir;  // 현재 이동 방향
     bool pendingGrowth;  // 다음 이동 시 성장 여부
-    chrono::time_point<chrono::steady_clock> prevMoveTime;  // 마지막 이동 시점
-    float intervalSec;  // 이동 간격(초 단위)
-    chrono::time_point<chrono::steady_clock> speedAdjustedAt;  // 속도 조절 시점
+    int ticksSinceMove;  // 마지막 이동 이후 지난 틱 수
+    int intervalTicks;  // 이동 간격(틱 단위)
     bool isBoosted;   // 속도 증가 상태
     bool isSlowed;    // 속도 감소 상태
 };
@@ -0,0 +1,375 @@
+#include "protocol.hpp"
+#include "netio.hpp"
+#include "scheduler.hpp"
+#include "input.hpp"
+#include "profiler.hpp"
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+
+// 게임 서버 - 연결마다 게임 하나를 돌리고 틱마다 바뀐 것만 보냄
+// epoll 하나로 모든 연결을 논블로킹으로 처리하는 단일 스레드 서버
+
+const int SERVER_MAX_EVENTS = 256;        // epoll_wait 한 번에 받는 이벤트 수
+const int SERVER_REPORT_SECONDS = 10;     // 상태 출력 간격
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop(int) {
+    stopRequested = 1;
+}
+
+// 서버 옵션
+struct ServerOptions {
+    string address;
+    int width, height;
+    uint64_t seed;                        // 첫 게임 시드 - 게임마다 1씩 늘림
+    int tickMs;
+    const LevelPack* pack;
+};
+
+// Session 구조체 - 연결 하나와 그 게임 (끊긴 세션 슬롯은 할당째 재사용)
+struct Session {
+    Session(int width, int height, uint64_t seed, const LevelPack* pack)
+        : state(width, height, seed, pack), encoder(width, height), active(false), started(false), stamped(false),
+          watchingOutput(false) {
+        state.setDamageTracking(true);
+    }
+
+    Connection io;
+    GameState state;
+    DeltaEncoder encoder;
+    InputQueue inputs;                    // 아직 적용하지 않은 방향 전환 (로컬 게임과 같은 규칙)
+    bool active;                          // 연결이 살아 있음
+    bool started;                         // HELLO를 받음
+    bool stamped;                         // TICK에 서버 시각을 붙임
+    bool watchingOutput;                  // EPOLLOUT을 기다리는 중
+};
+
+// GameServer 클래스
+class GameServer {
+public:
+    explicit GameServer(const ServerOptions& options);
+    ~GameServer();
+
+    bool start(string& error);
+    void run();
+    void printStats(FILE* out) const;
+
+private:
+    void acceptClients();
+    void handleReadable(int slot);
+    bool handleMessage(Session& session, MessageType type, size_t begin, size_t end);
+    void newGame(Session& session);
+    void flushSession(int slot);
+    void closeSession(int slot);
+    void tickAll();
+    void report();
+
+    ServerOptions options;
+    int epollFd;
+    int listenFd;
+    vector<unique_ptr<Session>> sessions; // 슬롯 번호 = epoll 데이터 - 1
+    vector<int> freeSlots;
+    FixedStepScheduler scheduler;
+    PhaseHistogram tickTimes;             // 한 틱에 모든 세션을 진행하고 보내는 시간
+    uint64_t nextSeed;
+    int activeCount;
+    int peakCount;
+    long acceptedCount;
+    long droppedSlow;                     // 출력이 밀려서 끊은 연결 수
+    uint64_t bytesSent;
+    long lastReport;
+};
+
+GameServer::GameServer(const ServerOptions& options)
+    : options(options), epollFd(-1), listenFd(-1), scheduler(options.tickMs, 8), nextSeed(options.seed),
+      activeCount(0), peakCount(0), acceptedCount(0), droppedSlow(0), bytesSent(0), lastReport(0) {}
+
+GameServer::~GameServer() {
+    for (auto& session : sessions) session->io.close();
+    if (listenFd >= 0) close(listenFd);
+    if (options.address.compare(0, 5, "unix:") == 0) unlink(options.address.c_str() + 5);
+    if (epollFd >= 0) close(epollFd);
+}
+
+// 리스닝 소켓과 epoll 준비
+bool GameServer::start(string& error) {
+    listenFd = listenSocket(options.address, error);
+    if (listenFd < 0) return false;
+
+    epollFd = epoll_create1(0);
+    if (epollFd < 0) {
+        error = strerror(errno);
+        return false;
+    }
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.u64 = 0;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+    return true;
+}
+
+// 메인 루프 - 다음 틱까지 이벤트를 처리하고, 틱 시각이 되면 모든 게임 진행
+void GameServer::run() {
+    epoll_event events[SERVER_MAX_EVENTS];
+    scheduler.start();
+    while (!stopRequested) {
+        int n = epoll_wait(epollFd, events, SERVER_MAX_EVENTS, scheduler.msUntilNextStep());
+        for (int i = 0; i < n; ++i) {
+            if (events[i].data.u64 == 0) {
+                acceptClients();
+                continue;
+            }
+            int slot = static_cast<int>(events[i].data.u64 - 1);
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) handleReadable(slot);
+            if ((events[i].events & EPOLLOUT) && sessions[slot]->active) flushSession(slot);
+        }
+
+        int steps = scheduler.collectSteps();
+        for (int i = 0; i < steps; ++i) tickAll();
+        if (scheduler.getStepCount() * options.tickMs / 1000 >= lastReport + SERVER_REPORT_SECONDS) report();
+    }
+}
+
+// 대기 중인 연결을 모두 받음 - 빈 슬롯이 있으면 재사용
+void GameServer::acceptClients() {
+    int fd;
+    while ((fd = acceptSocket(listenFd)) >= 0) {
+        int slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slot = static_cast<int>(sessions.size());
+            sessions.emplace_back(new Session(options.width, options.height, nextSeed, options.pack));
+        }
+        Session& session = *sessions[slot];
+        session.io.fd = fd;
+        session.active = true;
+        session.started = false;
+        session.watchingOutput = false;
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = static_cast<uint64_t>(slot) + 1;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+
+        ++acceptedCount;
+        if (++activeCount > peakCount) peakCount = activeCount;
+    }
+}
+
+// 받은 프레임 처리
+void GameServer::handleReadable(int slot) {
+    Session& session = *sessions[slot];
+    if (!session.active) return;
+    if (!session.io.receive()) {
+        closeSession(slot);
+        return;
+    }
+
+    MessageType type;
+    size_t begin, end;
+    while (true) {
+        FrameStatus status = readFrame(session.io.input, session.io.inputPos, type, begin, end, MAX_CLIENT_FRAME_BYTES);
+        if (status == FRAME_PARTIAL) break;
+        if (status == FRAME_BAD || !handleMessage(session, type, begin, end)) {
+            closeSession(slot);
+            return;
+        }
+    }
+    session.io.compactInput();
+    flushSession(slot);
+}
+
+// 클라이언트 메시지 하나 - 프로토콜 위반이면 false (연결을 끊음)
+bool GameServer::handleMessage(Session& session, MessageType type, size_t begin, size_t end) {
+    const vector<uint8_t>& in = session.io.input;
+    switch (type) {
+        case MSG_HELLO:
+            if (session.started || end - begin < 2 || in[begin] != PROTOCOL_VERSION) return false;
+            session.started = true;
+            session.stamped = (in[begin + 1] & HELLO_TIMESTAMPS) != 0;
+            newGame(session);
+            return true;
+
+        case MSG_INPUT: {
+            if (!session.started || end - begin < 1) return false;
+            Direction dir;
+            switch (in[begin]) {
+                case ACT_UP:    dir = UP; break;
+                case ACT_DOWN:  dir = DOWN; break;
+                case ACT_LEFT:  dir = LEFT; break;
+                case ACT_RIGHT: dir = RIGHT; break;
+                default:        return true;
+            }
+            session.inputs.push(dir, session.state.getSerpent().getCurrentDirection());
+            return true;
+        }
+
+        case MSG_RESTART:
+            if (!session.started) return false;
+            if (session.state.isOver()) newGame(session);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// 새 게임 시작 후 전체 상태 전송 (게임 상태 할당은 재사용)
+void GameServer::newGame(Session& session) {
+    session.state.reset(nextSeed++);
+    session.inputs.clear();
+    session.encoder.encodeSnapshot(session.state, session.io.output);
+}
+
+// 밀린 출력 보내기 - 다 못 보냈으면 EPOLLOUT을 기다리고, 너무 밀리면 끊음
+void GameServer::flushSession(int slot) {
+    Session& session = *sessions[slot];
+    size_t before = session.io.pendingOutput();
+    if (!session.io.flush()) {
+        closeSession(slot);
+        return;
+    }
+    bytesSent += before - session.io.pendingOutput();
+    if (session.io.pendingOutput() > MAX_PENDING_OUTPUT) {
+        ++droppedSlow;
+        closeSession(slot);
+        return;
+    }
+
+    bool pending = session.io.hasPendingOutput();
+    if (pending != session.watchingOutput) {
+        session.watchingOutput = pending;
+        epoll_event event = {};
+        event.events = pending ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+        event.data.u64 = static_cast<uint64_t>(slot) + 1;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, session.io.fd, &event);
+    }
+}
+
+// 연결 닫기 - 슬롯은 다음 연결이 씀
+void GameServer::closeSession(int slot) {
+    Session& session = *sessions[slot];
+    if (!session.active) return;
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, session.io.fd, nullptr);
+    session.io.close();
+    session.active = false;
+    freeSlots.push_back(slot);
+    --activeCount;
+}
+
+// 모든 게임 한 틱 진행 후 변화 전송 - 끝난 게임은 RESTART를 받을 때까지 멈춤
+void GameServer::tickAll() {
+    auto start = chrono::steady_clock::now();
+    uint64_t stamp = static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(start.time_since_epoch()).count());
+
+    for (int slot = 0; slot < static_cast<int>(sessions.size()); ++slot) {
+        Session& session = *sessions[slot];
+        if (!session.active || !session.started || session.state.isOver()) continue;
+
+        Action action = ACT_NONE;
+        Direction dir;
+        if (session.state.movesOnNextStep() && session.inputs.pop(dir)) action = actionFor(dir);
+        session.state.step(action);
+        session.encoder.encodeTick(session.state, session.stamped, stamp, session.io.output);
+        flushSession(slot);
+    }
+
+    auto ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    tickTimes.record(static_cast<uint64_t>(ns));
+}
+
+// 주기적 상태 출력
+void GameServer::report() {
+    lastReport = scheduler.getStepCount() * options.tickMs / 1000;
+    fprintf(stderr, "[%lds] sessions %d, tick p50 %.1f us, p99 %.1f us, dropped ticks %ld\n", lastReport, activeCount,
+            tickTimes.percentile(0.5) / 1000.0, tickTimes.percentile(0.99) / 1000.0, scheduler.getDroppedSteps());
+}
+
+// 종료 통계
+void GameServer::printStats(FILE* out) const {
+    fprintf(out, "sessions: %ld accepted, peak %d, %ld dropped as slow\n", acceptedCount, peakCount, droppedSlow);
+    fprintf(out, "ticks: %ld (dropped %ld), jitter mean %.2f ms, max %.2f ms\n", scheduler.getStepCount(),
+            scheduler.getDroppedSteps(), scheduler.meanJitterMs(), scheduler.maxJitterMs());
+    fprintf(out, "tick time: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us\n", tickTimes.mean() / 1000.0,
+            tickTimes.percentile(0.5) / 1000.0, tickTimes.percentile(0.99) / 1000.0, tickTimes.getMax() / 1000.0);
+    fprintf(out, "sent: %.1f MB\n", bytesSent / 1e6);
+}
+
+// 사용법 출력
+static int usage(const char* program) {
+    fprintf(stderr, "usage: %s [--listen unix:PATH | tcp:PORT] [--size WxH | --levels PACK] [--seed N] [--tick-ms N]\n",
+            program);
+    fprintf(stderr, "       default address is %s (loopback only)\n", DEFAULT_SERVER_ADDRESS);
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    ServerOptions options;
+    options.address = DEFAULT_SERVER_ADDRESS;
+    options.width = 42;
+    options.height = 21;
+    options.seed = static_cast<uint64_t>(time(0));
+    options.tickMs = TICK_MS;
+    options.pack = nullptr;
+    string levelsPath;
+    bool sizeSet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--listen") == 0 && i + 1 < argc) options.address = argv[++i];
+        else if (strcmp(argv[i], "--levels") == 0 && i + 1 < argc) levelsPath = argv[++i];
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) options.seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--tick-ms") == 0 && i + 1 < argc) {
+            options.tickMs = atoi(argv[++i]);
+            if (options.tickMs < 1) return usage(argv[0]);
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2 || options.width < MIN_BOARD_WIDTH ||
+                options.height < MIN_BOARD_HEIGHT || static_cast<long>(options.width) * options.height > MAX_BOARD_CELLS) {
+                return usage(argv[0]);
+            }
+            sizeSet = true;
+        }
+        else return usage(argv[0]);
+    }
+
+    LevelPack pack;
+    if (!levelsPath.empty()) {
+        if (sizeSet) return usage(argv[0]);
+        if (!pack.open(levelsPath)) {
+            fprintf(stderr, "cannot read levels: %s\n", pack.getError().c_str());
+            return 1;
+        }
+        options.width = pack.getWidth();
+        options.height = pack.getHeight();
+        options.pack = &pack;
+    }
+
+    raiseFileLimit();
+    signal(SIGINT, requestStop);
+    signal(SIGTERM, requestStop);
+    signal(SIGPIPE, SIG_IGN);
+
+    GameServer server(options);
+    string error;
+    if (!server.start(error)) {
+        fprintf(stderr, "cannot listen on %s: %s\n", options.address.c_str(), error.c_str());
+        return 1;
+    }
+    fprintf(stderr, "listening on %s (%dx%d, tick %d ms)\n", options.address.c_str(), options.width, options.height,
+            options.tickMs);
+
+    server.run();
+    server.printStats(stdout);
+    return 0;
+}
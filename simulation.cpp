@@ -0,0 +1,730 @@
+#include "simulation.hpp"
+#include "profiler.hpp"
+#include <cstdlib>
+#include <algorithm>
+
+// 아이템 종류별 설정 (ItemKind 순서)
+static const ItemSpec itemSpecs[ITEM_KIND_COUNT] = {
+    { CELL_GROW,   3, ITEM_LIFETIME_TICKS },  // 성장
+    { CELL_POISON, 3, ITEM_LIFETIME_TICKS },  // 독
+    { CELL_BOOST,  1, ITEM_LIFETIME_TICKS },  // 속도 증가
+    { CELL_SLOW,   1, ITEM_LIFETIME_TICKS }   // 속도 감소
+};
+
+// 게임 상태 생성자
+GameState::GameState(int width, int height, uint64_t seed, const LevelPack* pack)
+    : rng(seed), pack(pack), items(width * height), serpent(width / 2, height / 2, width, height), width(width), height(height),
+      map(width, height), localSpawn(width * height > LOCAL_SPAWN_CELLS),
+      freeCells(localSpawn ? 0 : width * height), wallCells(localSpawn ? 0 : width * height),
+      freeChunks(localSpawn ? width : 0, localSpawn ? height : 0), wallChunks(localSpawn ? width : 0, localSpawn ? height : 0),
+      gateA(-1, -1), gateB(-1, -1), bladeCount(width * height, 0),
+      growScore(0), poisonScore(0), gateScore(0), maxLength(0),
+      stageLevel(1), missionLen(4), missionGrow(1), missionPoison(1), missionGate(1), missionMaxLen(5),
+      missionLenDone(false), missionGrowDone(false), missionPoisonDone(false), missionGateDone(false), missionMaxDone(false),
+      gatesActive(false), gateTimer(NO_TIMER), speedTimer(NO_TIMER),
+      totalTicks(0), stageTicks(0), gameOver(false), cleared(false),
+      overReason(OVER_NONE), trackDamage(false), fullRedraw(true), dirtyMark(width * height, 0) {
+    int itemCap = 0;
+    for (const ItemSpec& spec : itemSpecs) itemCap += spec.cap;
+    items.reserve(itemCap);
+    windmills.reserve(4);
+    bladeCells.reserve(8 * 2 * max(width, height));
+    reset(seed);
+}
+
+// 새 게임으로 초기화 - 맵/뱀/목록 버퍼는 그대로 재사용함
+void GameState::reset(uint64_t seed) {
+    rng.reseed(seed);
+
+    stageLevel = 1;
+    missionLen = 4;
+    missionGrow = 1;
+    missionPoison = 1;
+    missionGate = 1;
+    missionMaxLen = 5;
+
+    totalTicks = 0;
+    gameOver = false;
+    cleared = false;
+    overReason = OVER_NONE;
+
+    resetStage(); // 맵/스테이지/아이템 초기화
+}
+
+// 게임 오버 사유 이름
+const char* gameOverReasonName(GameOverReason reason) {
+    switch (reason) {
+        case OVER_NONE:         return "running";
+        case OVER_WALL:         return "hit a wall";
+        case OVER_SELF:         return "hit itself";
+        case OVER_WINDMILL:     return "hit the windmill";
+        case OVER_POISON:       return "too short";
+        case OVER_TIMEOUT:      return "time over";
+        case OVER_GATE_BLOCKED: return "gate blocked";
+        case OVER_CLEARED:      return "all stages cleared";
+        case OVER_SNAKE:        return "hit another snake";
+    }
+    return "unknown";
+}
+
+// 칸 변경 - 맵과 빈 칸/벽 목록을 함께 갱신 (덮인 아이템은 풀에서 빠짐)
+void GameState::setCell(int x, int y, Cell cell) {
+    int index = map.index(x, y);
+    map.set(x, y, cell);
+    timers.cancel(items.take(index));
+    syncCell(index);
+}
+
+// 한 칸의 빈 칸/벽 목록 소속을 현재 맵과 뱀 상태에 맞춤
+void GameState::syncCell(int index) {
+    Cell cell = map.atIndex(index);
+    bool free = cell == CELL_EMPTY && !serpent.occupiesIndex(index);
+    bool gateWall = cell == CELL_WALL && bladeCount[index] == 0;  // 바람개비 날은 게이트 불가
+    if (localSpawn) {
+        if (free) freeChunks.insert(index);
+        else freeChunks.erase(index);
+        if (gateWall) wallChunks.insert(index);
+        else wallChunks.erase(index);
+    } else {
+        if (free) freeCells.insert(index);
+        else freeCells.erase(index);
+        if (gateWall) wallCells.insert(index);
+        else wallCells.erase(index);
+    }
+
+    // 화면에서 다시 그려야 할 칸으로 기록
+    if (trackDamage && !dirtyMark[index]) {
+        dirtyMark.write(index) = 1;
+        dirtyCells.push_back(index);
+    }
+}
+
+// 맵 전체를 훑어 빈 칸/벽 목록을 다시 만듦 (스테이지 시작 시에만)
+void GameState::rebuildCellIndex() {
+    freeCells.clear();
+    wallCells.clear();
+    freeChunks.clear();
+    wallChunks.clear();
+    for (int i = 0; i < width * height; ++i) syncCell(i);
+
+    // 칸별 기록 대신 전체 다시 그리기로 표시
+    clearDamage();
+    fullRedraw = true;
+}
+
+// 변경 칸 추적 켜기/끄기 - 화면이 없는 시뮬레이션은 끈 채로 둠
+void GameState::setDamageTracking(bool enabled) {
+    trackDamage = enabled;
+    clearDamage();
+    fullRedraw = true;
+}
+
+// 변경 칸 목록 비우기 - 화면에 반영한 뒤 호출
+void GameState::clearDamage() {
+    for (int index : dirtyCells) dirtyMark.write(index) = 0;
+    dirtyCells.clear();
+    fullRedraw = false;
+}
+
+// 뱀 꼬리 칸 번호
+int GameState::tailIndex() const {
+    PackedCell tail = serpent.getTail();
+    return map.index(cellX(tail), cellY(tail));
+}
+
+// 뱀 머리 칸 번호
+int GameState::headIndex() const {
+    auto head = serpent.getHeadPosition();
+    return map.index(head.first, head.second);
+}
+
+// 넓은 맵에서 머리 주변에 원소가 need개 이상 있는 가장 작은 반지름 (두 배씩 넓힘), count에 그 안의 원소 수
+int GameState::localRadius(const ChunkedCellSet& cells, int need, int& count) const {
+    int radius = LOCAL_SPAWN_RADIUS;
+    count = cells.countNear(headIndex(), radius);
+    while (count < need && radius < cells.coveringRadius()) {
+        radius *= 2;
+        count = cells.countNear(headIndex(), radius);
+    }
+    return radius;
+}
+
+// 빈 칸 하나를 무작위 선택 - 빈 칸이 없으면 false
+bool GameState::pickFreeCell(int& x, int& y) {
+    int cell;
+    if (localSpawn) {
+        int count;
+        int radius = localRadius(freeChunks, 1, count);
+        if (count == 0) return false;
+        cell = freeChunks.atNear(headIndex(), radius, rng.below(count));
+    } else {
+        if (freeCells.empty()) return false;
+        cell = freeCells.at(rng.below(freeCells.size()));
+    }
+    x = cell % width;
+    y = cell / width;
+    return true;
+}
+
+// 서로 다른 벽 두 칸을 무작위 선택 - 벽이 부족하면 false
+bool GameState::pickGateCells(pair<int, int>& a, pair<int, int>& b) {
+    int count = wallCells.size();
+    int radius = localSpawn ? localRadius(wallChunks, 2, count) : 0;
+    if (count < 2) return false;
+    int i = rng.below(count);
+    int j = rng.below(count - 1);
+    if (j >= i) ++j;
+    int cellA = localSpawn ? wallChunks.atNear(headIndex(), radius, i) : wallCells.at(i);
+    int cellB = localSpawn ? wallChunks.atNear(headIndex(), radius, j) : wallCells.at(j);
+    a = { cellA % width, cellA / width };
+    b = { cellB % width, cellB / width };
+    return true;
+}
+
+// 입력 적용 후 한 틱 진행
+bool GameState::step(Action action) {
+    if (gameOver) return false;
+
+    bool accepted = true;
+    switch (action) {
+        case ACT_UP:    accepted = serpent.setDirection(UP); break;
+        case ACT_DOWN:  accepted = serpent.setDirection(DOWN); break;
+        case ACT_LEFT:  accepted = serpent.setDirection(LEFT); break;
+        case ACT_RIGHT: accepted = serpent.setDirection(RIGHT); break;
+        case ACT_NONE:  break;
+    }
+
+    // 역방향 입력은 자기 몸에 부딪힌 것으로 처리
+    if (!accepted) {
+        endGame(OVER_SELF);
+        return false;
+    }
+
+    tick();
+    return !gameOver;
+}
+
+// 게임 오버 처리 - 사유를 남기고 멈춤
+void GameState::endGame(GameOverReason reason) {
+    gameOver = true;
+    overReason = reason;
+    cleared = (reason == OVER_CLEARED);
+}
+
+
+// 게이트 통과
+void GameState::useGate(const std::pair<int, int>& exitGate) {
+    auto exitX = exitGate.first;
+    auto exitY = exitGate.second;
+    std::pair<int, int> newHead = { -1, -1 };
+    Direction newDirection = serpent.getCurrentDirection();
+    Direction entryDirection = serpent.getCurrentDirection();
+
+    // 진입 방향 우선순위 설정 (힙 할당 없는 고정 테이블)
+    static const Direction priorities[4][4] = {
+        { UP, RIGHT, LEFT, DOWN },     // UP
+        { DOWN, RIGHT, LEFT, UP },     // DOWN
+        { LEFT, UP, DOWN, RIGHT },     // LEFT
+        { RIGHT, DOWN, UP, LEFT },     // RIGHT
+    };
+    const Direction* directions = priorities[entryDirection];
+
+
+    // 새로운 머리 위치랑 방향 설정
+    for (int d = 0; d < 4; ++d) {
+        switch (directions[d]) {
+            case UP:
+                if (exitY > 0 && map.at(exitX, exitY - 1) == CELL_EMPTY && !serpent.occupies(exitX, exitY - 1)) {
+                    newHead = { exitX, exitY - 1 };
+                    newDirection = UP;
+                }
+                break;
+            case DOWN:
+                if (exitY < height - 1 && map.at(exitX, exitY + 1) == CELL_EMPTY && !serpent.occupies(exitX, exitY + 1)) {
+                    newHead = { exitX, exitY + 1 };
+                    newDirection = DOWN;
+                }
+                break;
+            case LEFT:
+                if (exitX > 0 && map.at(exitX - 1, exitY) == CELL_EMPTY && !serpent.occupies(exitX - 1, exitY)) {
+                    newHead = { exitX - 1, exitY };
+                    newDirection = LEFT;
+                }
+                break;
+            case RIGHT:
+                if (exitX < width - 1 && map.at(exitX + 1, exitY) == CELL_EMPTY && !serpent.occupies(exitX + 1, exitY)) {
+                    newHead = { exitX + 1, exitY };
+                    newDirection = RIGHT;
+                }
+                break;
+        }
+        if (newHead != std::pair<int, int>{-1, -1}) break;
+    }
+
+
+    // 유효한 위치 없으면 종료
+    if (newHead == std::pair<int, int>{-1, -1}) {
+        endGame(OVER_GATE_BLOCKED);
+        return;
+    }
+
+    int oldTail = tailIndex();
+    serpent.assignHead(newHead, newDirection);
+    syncCell(oldTail);
+    syncCell(headIndex());
+
+
+    // 바람개비 회전 멈춤(게이트가 내에 있는 경우) - 다음 회전을 정지 시간 뒤로 미룸
+    for (size_t w = 0; w < windmills.size(); ++w) {
+        Windmill& windmill = windmills[w];
+        if (gateInsideWindmill(windmill, exitGate) && timers.cancel(windmill.spinTimer)) {
+            windmill.spinTimer = timers.schedule(totalTicks + WINDMILL_PAUSE_TICKS, TIMER_WINDMILL_SPIN, static_cast<int>(w));
+        }
+    }
+}
+
+
+// 상태 업데이트
+void GameState::tick() {
+    PROFILE_SCOPE(PHASE_SIM_TICK);
+    ++totalTicks;
+    ++stageTicks;
+
+    // 테두리가 벽이 아닌 맵에서 머리가 맵 밖으로 나가려 하면 움직이기 전에 벽 충돌로 끝냄 (칸 번호가 맵을 벗어나지 않게)
+    if (serpent.movesOnNextRefresh()) {
+        auto head = serpent.getHeadPosition();
+        Direction dir = serpent.getCurrentDirection();
+        int x = head.first + (dir == RIGHT ? 1 : dir == LEFT ? -1 : 0);
+        int y = head.second + (dir == DOWN ? 1 : dir == UP ? -1 : 0);
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            endGame(OVER_WALL);
+            return;
+        }
+    }
+
+    int oldTail = tailIndex();
+    if (serpent.refresh()) {
+        syncCell(oldTail);
+        syncCell(headIndex());
+    }
+
+
+    // 길이 업데이트
+    if (serpent.length() > maxLength) {
+        maxLength = serpent.length();
+    }
+
+
+    // 이번 틱에 발동하는 타이머 처리 (아이템 만료, 게이트, 속도, 바람개비, 시간 초과)
+    {
+        PROFILE_SCOPE(PHASE_SIM_TIMERS);
+        timers.advance(totalTicks);
+        TimerEvent event;
+        while (timers.popDue(event)) {
+            fireTimer(event);
+            if (gameOver) return;
+        }
+    }
+
+    auto head = serpent.getHeadPosition();
+
+
+    // 벽 or 장애물 or 스스로 충돌 시 게임 오버
+    if (map.at(head.first, head.second) == CELL_WALL || map.at(head.first, head.second) == CELL_IMMUNE_WALL) {
+        endGame(OVER_WALL);
+        return;
+    }
+    if (serpent.detectCollision()) {
+        endGame(OVER_SELF);
+        return;
+    }
+
+
+
+    // 아이템 경우 처리
+    if (!consumeItem(map.index(head.first, head.second))) return;
+
+
+    //게이트 통과
+    if (head == gateA) {
+        useGate(gateB);
+        gateScore++;
+    }
+    else if (head == gateB) {
+        useGate(gateA);
+        gateScore++;
+    }
+    if (gameOver) return;
+
+
+    // 미션 상태 업데이트
+    checkMissions();
+
+
+    //완료 했을 경우 스테이지 다음 진행
+    if (missionLenDone && missionGrowDone && missionPoisonDone && missionGateDone) {
+        proceedNextStage();
+        if (gameOver) return;
+    }
+
+    distributeItems();
+}
+
+
+
+// 미션 상태 업데이트 버전
+void GameState::checkMissions() {
+    missionLenDone = (serpent.length() >= missionLen);
+    missionGrowDone = (growScore >= missionGrow);
+    missionPoisonDone = (poisonScore >= missionPoison);
+    missionGateDone = (gateScore >= missionGate);
+    missionMaxDone = (maxLength >= missionMaxLen);
+}
+
+
+// 다음 스테이지로 진행
+void GameState::proceedNextStage() {
+    stageLevel++;
+    if (stageLevel > getStageCount()) {
+        endGame(OVER_CLEARED);
+    } else {
+        // 오직 성장 아이템 미션만 +1
+        missionGrow += 1;
+
+        resetStage();  // 스테이지 재설정
+        serpent.defineInterval(BASE_INTERVAL / 2);  // 뱀 속도 증가 (첫 스테이지의 두 배)
+    }
+}
+
+
+
+// 초기 맵 설정
+void GameState::setupMap() {
+    map.clear();
+    for (int i = 0; i < width; ++i) {
+        map.set(i, 0, CELL_WALL);
+        map.set(i, height - 1, CELL_WALL);
+    }
+    for (int i = 0; i < height; ++i) {
+        map.set(0, i, CELL_WALL);
+        map.set(width - 1, i, CELL_WALL);
+    }
+    map.set(0, 0, CELL_IMMUNE_WALL);
+    map.set(width - 1, 0, CELL_IMMUNE_WALL);
+    map.set(0, height - 1, CELL_IMMUNE_WALL);
+    map.set(width - 1, height - 1, CELL_IMMUNE_WALL);
+}
+
+
+//스테이지 초기화
+
+void GameState::setupStage() {
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (map.at(x, y) != CELL_WALL && map.at(x, y) != CELL_IMMUNE_WALL) {
+                map.set(x, y, CELL_EMPTY);
+            }
+        }
+    }
+
+    if (stageLevel == 2) {
+        int startX = 15;
+        int startY = height - 15;
+        for (int i = startY; i < height - 5; ++i) {
+            map.set(startX, i, CELL_WALL);
+        }
+        for (int i = 5; i < startX; ++i) {
+            map.set(i, startY, CELL_WALL);
+        }
+    }
+    else if (stageLevel == 3) {
+        for (int i = 5; i < width - 5; ++i) {
+            map.set(i, height / 3, CELL_WALL);
+            map.set(i, 2 * height / 3, CELL_WALL);
+        }
+    }
+    else if (stageLevel == 4) {
+        addWindmill(width / 2, height / 2, 5, WINDMILL_SPIN_TICKS);
+        serpent.reset(width - 5, 1);
+        serpent.setDirection(DOWN);
+    }
+}
+
+
+
+// 아이템 배치 - 종류마다 최대 개수보다 적으면 한 개씩 추가
+void GameState::distributeItems() {
+    PROFILE_SCOPE(PHASE_SIM_ITEMS);
+    int now = totalTicks;
+
+    for (int k = 0; k < ITEM_KIND_COUNT; ++k) {
+        const ItemSpec& spec = itemSpecs[k];
+        if (items.count(static_cast<ItemKind>(k)) >= itemCaps[k]) continue;
+
+        int x, y;
+        if (pickFreeCell(x, y)) {
+            int index = map.index(x, y);
+            setCell(x, y, spec.cell);
+            items.spawn(static_cast<ItemKind>(k), index,
+                        timers.schedule(now + spec.lifetimeTicks, TIMER_ITEM_EXPIRE, index));
+        }
+    }
+
+    // 게이트 생성 조건 확인
+    if (serpent.length() >= 4 && !gatesActive) {
+        if (pickGateCells(gateA, gateB)) {
+            setCell(gateA.first, gateA.second, CELL_GATE);
+            setCell(gateB.first, gateB.second, CELL_GATE);
+
+            gateTimer = timers.schedule(now + GATE_LIFETIME_TICKS, TIMER_GATE_REGEN);
+            gatesActive = true;
+        }
+    }
+}
+
+// 게이트 재생성 - 뱀이 게이트를 지나는 중이면 다음 틱에 다시 시도
+void GameState::regenerateGates() {
+    int now = totalTicks;
+    if (serpent.occupies(gateA.first, gateA.second) || serpent.occupies(gateB.first, gateB.second)) {
+        gateTimer = timers.schedule(now + 1, TIMER_GATE_REGEN);
+        return;
+    }
+
+    if (gateA.first != -1) setCell(gateA.first, gateA.second, CELL_WALL);
+    if (gateB.first != -1) setCell(gateB.first, gateB.second, CELL_WALL);
+
+    if (pickGateCells(gateA, gateB)) {
+        setCell(gateA.first, gateA.second, CELL_GATE);
+        setCell(gateB.first, gateB.second, CELL_GATE);
+        gateTimer = timers.schedule(now + GATE_LIFETIME_TICKS, TIMER_GATE_REGEN);
+    } else {
+        gateA = { -1, -1 };
+        gateB = { -1, -1 };
+        gatesActive = false;
+        gateTimer = NO_TIMER;
+    }
+}
+
+// 발동한 타이머 처리
+void GameState::fireTimer(const TimerEvent& event) {
+    switch (event.kind) {
+        case TIMER_ITEM_EXPIRE:  // 오래된 아이템 제거
+            setCell(event.payload % width, event.payload / width, CELL_EMPTY);
+            break;
+
+        case TIMER_GATE_REGEN:
+            regenerateGates();
+            break;
+
+        case TIMER_SPEED_RESET:  // 속도 원래대로
+            serpent.restoreSpeed();
+            speedTimer = NO_TIMER;
+            break;
+
+        case TIMER_WINDMILL_SPIN: {  // 일정 틱마다 바람개비 회전 (payload = 바람개비 번호)
+            Windmill& windmill = windmills[event.payload];
+            spinWindmill(windmill);
+            windmill.spinTimer = timers.schedule(totalTicks + windmill.spinTicks, TIMER_WINDMILL_SPIN, event.payload);
+            break;
+        }
+
+        case TIMER_STAGE_TIMEOUT:  // 시간 초과인 경우 게임 오버
+            endGame(OVER_TIMEOUT);
+            break;
+    }
+}
+
+// 머리 칸 아이템 먹기
+bool GameState::consumeItem(int index) {
+    ItemKind kind;
+    if (!items.kindAt(index, kind)) return true;
+    setCell(index % width, index / width, CELL_EMPTY);
+
+    switch (kind) {
+        case ITEM_GROW:  // 성장
+            serpent.extend();
+            growScore++;
+            break;
+
+        case ITEM_POISON: {  // 독 - 길이 3 미만이면 게임 오버
+            int shrunkTail = tailIndex();
+            serpent.shrink();
+            syncCell(shrunkTail);
+            poisonScore++;
+            if (serpent.length() < 3) {
+                endGame(OVER_POISON);
+                return false;
+            }
+            break;
+        }
+
+        case ITEM_BOOST:  // 속도 증가 - 일정 시간 뒤 복구
+            serpent.boostSpeed();
+            timers.cancel(speedTimer);
+            speedTimer = timers.schedule(totalTicks + SPEED_EFFECT_TICKS, TIMER_SPEED_RESET);
+            break;
+
+        case ITEM_SLOW:  // 속도 감소 - 일정 시간 뒤 복구
+            serpent.reduceSpeed();
+            timers.cancel(speedTimer);
+            speedTimer = timers.schedule(totalTicks + SPEED_EFFECT_TICKS, TIMER_SPEED_RESET);
+            break;
+
+        case ITEM_KIND_COUNT:
+            break;
+    }
+    return true;
+}
+
+
+// 스테이지 상태 초기화
+void GameState::resetStage() {
+    growScore = 0;
+    poisonScore = 0;
+    gateScore = 0;
+    maxLength = 0;
+
+    missionLenDone = false;
+    missionGrowDone = false;
+    missionPoisonDone = false;
+    missionGateDone = false;
+    missionMaxDone = false;
+
+    gateA = { -1, -1 };
+    gateB = { -1, -1 };
+    gatesActive = false;
+
+    // 이전 스테이지 타이머 모두 취소 후 제한 시간 예약
+    items.clear();
+    timers.clear(totalTicks);
+    gateTimer = NO_TIMER;
+    speedTimer = NO_TIMER;
+    windmills.clear();
+    bladeCells.clear();
+    bladeCount.fill(0);
+    timers.schedule(totalTicks + STAGE_TIME_TICKS + 1, TIMER_STAGE_TIMEOUT);
+
+    stageTicks = 0; // 스테이지 시간 초기화
+
+    if (pack) {
+        loadPackStage();
+    } else {
+        if (stageLevel == 4) {
+            serpent.reset(width - 5, 1);  // 뱀 오른쪽 상단에서 시작하게
+            serpent.setDirection(DOWN);
+        } else {
+            serpent.reset(width / 2, height / 2);  // 기본 위치
+        }
+        for (int k = 0; k < ITEM_KIND_COUNT; ++k) itemCaps[k] = itemSpecs[k].cap;
+
+        setupMap();
+        setupStage();
+    }
+    rebuildCellIndex();
+    distributeItems();
+}
+
+// 레벨 팩 스테이지 세팅 - 칸은 매핑된 파일에서 바로 복사함
+void GameState::loadPackStage() {
+    StageView view = pack->stage(stageLevel - 1);
+
+    map.assign(view.getCells());
+    for (int k = 0; k < view.getWindmillCount(); ++k) {
+        WindmillSpec spec = view.getWindmill(k);
+        addWindmill(spec.centerX, spec.centerY, spec.length, spec.spinTicks);
+    }
+    serpent.reset(view.getSpawnX(), view.getSpawnY(), static_cast<Direction>(view.getSpawnDir()));
+
+    missionLen = view.getMissionLen();
+    missionMaxLen = view.getMissionMaxLen();
+    missionGrow = view.getMissionGrow();
+    missionPoison = view.getMissionPoison();
+    missionGate = view.getMissionGate();
+
+    int itemCap = 0;
+    for (int k = 0; k < ITEM_KIND_COUNT; ++k) {
+        itemCaps[k] = view.getItemCap(k);
+        itemCap += itemCaps[k];
+    }
+    items.reserve(itemCap);
+}
+
+// 각도별 날 방향 (45도 단위) - 0 -> 45 -> 90 -> ... -> 315, 반 바퀴 뒤 모양은 같음
+static const int bladeRays[8][2][2] = {
+    { {  0, 1 }, {  0, -1 } },
+    { {  1, 1 }, { -1, -1 } },
+    { {  1, 0 }, { -1,  0 } },
+    { { -1, 1 }, {  1, -1 } },
+    { {  0, -1 }, {  0, 1 } },
+    { { -1, -1 }, {  1, 1 } },
+    { { -1, 0 }, {  1,  0 } },
+    { {  1, -1 }, { -1, 1 } }
+};
+
+// 바람개비 추가 - 8개 각도의 날 칸 번호를 미리 계산해 두고 0도 날을 세움
+// 맵 안쪽(테두리 제외)을 벗어나는 칸은 마스크에서 뺌
+void GameState::addWindmill(int centerX, int centerY, int length, int spinTicks) {
+    Windmill windmill;
+    windmill.center = {centerX, centerY};
+    windmill.length = length;
+    windmill.state = 0;
+    windmill.spinTicks = spinTicks;
+
+    for (int state = 0; state < 8; ++state) {
+        windmill.maskOffset[state] = static_cast<int>(bladeCells.size());
+        for (int ray = 0; ray < 2; ++ray) {
+            for (int i = 1; i <= length; ++i) {
+                int x = centerX + bladeRays[state][ray][0] * i;
+                int y = centerY + bladeRays[state][ray][1] * i;
+                if (x < 1 || x >= width - 1 || y < 1 || y >= height - 1) break;
+                bladeCells.push_back(map.index(x, y));
+            }
+        }
+    }
+    windmill.maskOffset[8] = static_cast<int>(bladeCells.size());
+
+    // 스테이지 구성 중이므로 맵만 바꾸고 목록은 rebuildCellIndex()가 맞춤
+    for (int k = windmill.maskOffset[0]; k < windmill.maskOffset[1]; ++k) {
+        ++bladeCount.write(bladeCells[k]);
+        map.set(bladeCells[k] % width, bladeCells[k] / width, CELL_WALL);
+    }
+
+    windmill.spinTimer = timers.schedule(totalTicks + spinTicks, TIMER_WINDMILL_SPIN, static_cast<int>(windmills.size()));
+    windmills.push_back(windmill);
+}
+
+// 바람개비 회전 - 이전 각도 마스크를 내리고 새 마스크를 세움
+// 새 날이 뱀 몸통을 덮으면 게임 오버 (날 길이만큼만 검사)
+void GameState::spinWindmill(Windmill& windmill) {
+    int from = windmill.state;
+    int to = (from + 1) % 8;
+    windmill.state = to;
+
+    for (int k = windmill.maskOffset[from]; k < windmill.maskOffset[from + 1]; ++k) --bladeCount.write(bladeCells[k]);
+    for (int k = windmill.maskOffset[to]; k < windmill.maskOffset[to + 1]; ++k) ++bladeCount.write(bladeCells[k]);
+
+    // 다른 날이 덮지 않는 옛 칸만 비움
+    for (int k = windmill.maskOffset[from]; k < windmill.maskOffset[from + 1]; ++k) {
+        int index = bladeCells[k];
+        if (bladeCount[index] == 0) setCell(index % width, index / width, CELL_EMPTY);
+    }
+
+    for (int k = windmill.maskOffset[to]; k < windmill.maskOffset[to + 1]; ++k) {
+        int index = bladeCells[k];
+        if (map.atIndex(index) != CELL_WALL) setCell(index % width, index / width, CELL_WALL);
+        if (serpent.occupiesIndex(index)) endGame(OVER_WINDMILL);
+    }
+}
+
+// 바람개비와 게이트가 겹치는지
+bool GameState::gateInsideWindmill(const Windmill& windmill, const pair<int, int>& gate) const {
+    int x = gate.first;
+    int y = gate.second;
+    int cx = windmill.center.first;
+    int cy = windmill.center.second;
+    int len = windmill.length;
+
+    return (x == cx && abs(y - cy) <= len) ||
+           (y == cy && abs(x - cx) <= len) ||
+           (abs(x - cx) <= len && abs(y - cy) <= len);
+}
@@ -0,0 +1,209 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "serpent.hpp"
+#include "stagemap.hpp"
+#include "cellset.hpp"
+#include "chunkset.hpp"
+#include "itempool.hpp"
+#include "timerwheel.hpp"
+#include "levelpack.hpp"
+#include "rng.hpp"
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// 시뮬레이션 한 틱의 길이(ms) - 모든 시간은 틱 단위로 계산함
+const int TICK_MS = 25;
+
+const int ITEM_LIFETIME_TICKS = 400;     // 아이템 유지 시간 (10초)
+const int GATE_LIFETIME_TICKS = 800;     // 게이트 재생성 주기 (20초)
+const int STAGE_TIME_TICKS = 4800;       // 스테이지 제한 시간 (120초)
+const int WINDMILL_SPIN_TICKS = 40;      // 바람개비 회전 주기 (1초 - 스테이지 4 속도로 10번 이동)
+const int WINDMILL_PAUSE_TICKS = 40;     // 게이트 사용 시 바람개비 정지 시간 (1초)
+const int MAX_STAGE = 4;                 // 레벨 팩 없이 기본 스테이지 수
+
+// 넓은 맵 - 이보다 칸이 많으면 아이템/게이트를 뱀 머리 주변 청크에만 놓음
+const int LOCAL_SPAWN_CELLS = 256 * 256;
+const int LOCAL_SPAWN_RADIUS = 2;        // 머리 청크에서 몇 청크까지 (5x5 청크 = 160x160칸)
+const int MIN_BOARD_WIDTH = 42;          // 맵 크기 하한 (기본 스테이지가 들어가는 크기)
+const int MIN_BOARD_HEIGHT = 21;
+const int MAX_BOARD_CELLS = 4096 * 4096; // 맵 크기 상한
+
+// 아이템 종류별 설정 - 맵 표시, 동시에 놓일 수 있는 최대 개수, 유지 시간
+struct ItemSpec {
+    Cell cell;
+    int cap;
+    int lifetimeTicks;
+};
+
+// 한 틱 동안 들어온 입력
+enum Action { ACT_NONE, ACT_UP, ACT_DOWN, ACT_LEFT, ACT_RIGHT };
+
+// 게임 오버 사유
+enum GameOverReason {
+    OVER_NONE,          // 진행 중
+    OVER_WALL,          // 벽에 부딪힘
+    OVER_SELF,          // 자기 몸에 부딪힘 (역방향 입력 포함)
+    OVER_WINDMILL,      // 바람개비 날에 맞음
+    OVER_POISON,        // 독 아이템으로 길이 3 미만
+    OVER_TIMEOUT,       // 스테이지 제한 시간 초과
+    OVER_GATE_BLOCKED,  // 게이트 출구가 모두 막힘
+    OVER_CLEARED,       // 모든 스테이지 클리어
+    OVER_SNAKE          // 다른 뱀에 부딪힘 (아레나)
+};
+
+// 사유를 화면/로그용 문자열로 변환
+const char* gameOverReasonName(GameOverReason reason);
+
+// Windmill 구조체 - 회전 오브젝트를 표현함
+// 8개 각도의 날 칸 번호는 GameState::bladeCells에 모아 두고 maskOffset으로 구간을 가리킴
+struct Windmill {
+    pair<int, int> center;
+    int length;
+    int state;            // 현재 각도 (45도 단위, 0~7)
+    int spinTicks;        // 회전 주기 (틱)
+    TimerId spinTimer;    // 다음 회전 타이머
+    int maskOffset[9];    // 각도 k의 날 = bladeCells[maskOffset[k], maskOffset[k + 1])
+};
+
+// 스냅샷 형식 버전 (snapshot.cpp)
+const uint8_t SNAPSHOT_VERSION = 1;
+
+// GameState 클래스 - 화면/입력/시계와 무관한 게임 규칙 전체
+// 복사(fork)는 맵/뱀/칸 목록 같은 칸 단위 배열의 페이지를 공유하므로(copy-on-write) 맵 넓이와 무관하게 쌈
+// 복사본은 원본과 독립적으로 진행되며, 바뀐 페이지만 그때 복제됨
+class GameState {
+public:
+    // 생성자 - 같은 시드면 같은 게임
+    // 칸이 LOCAL_SPAWN_CELLS보다 많으면 아이템/게이트가 머리 근처에만 생김 (맵 넓이와 무관한 비용)
+    // pack이 있으면 스테이지를 팩에서 읽음 (팩은 GameState보다 오래 살아야 함, 크기는 같아야 함)
+    GameState(int width, int height, uint64_t seed, const LevelPack* pack = nullptr);
+
+    // 새 게임으로 초기화 - 기존 할당을 재사용하므로 게임을 이어서 돌려도 비용이 없음
+    void reset(uint64_t seed);
+
+    // 입력 하나를 적용하고 한 틱 진행 - 게임이 계속되면 true
+    bool step(Action action);
+
+    // 다음 step()에서 뱀이 움직이는지 - 방향 전환은 이때만 적용하면 됨
+    bool movesOnNextStep() const { return serpent.movesOnNextRefresh(); }
+
+    bool isOver() const { return gameOver; }
+    bool isCleared() const { return cleared; }
+    GameOverReason getOverReason() const { return overReason; }
+
+    // 조회용 함수
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    Cell cellAt(int x, int y) const { return map.at(x, y); }
+    const StageMap& getMap() const { return map; }
+    const Serpent& getSerpent() const { return serpent; }
+    int getStageLevel() const { return stageLevel; }
+    int getStageCount() const { return pack ? pack->size() : MAX_STAGE; }
+    int getStageTicks() const { return stageTicks; }
+    int getTotalTicks() const { return totalTicks; }
+    int getGrowScore() const { return growScore; }
+    int getPoisonScore() const { return poisonScore; }
+    int getGateScore() const { return gateScore; }
+    int getMaxLength() const { return maxLength; }
+    int getMissionLen() const { return missionLen; }
+    int getMissionMaxLen() const { return missionMaxLen; }
+    int getMissionGrow() const { return missionGrow; }
+    int getMissionPoison() const { return missionPoison; }
+    int getMissionGate() const { return missionGate; }
+    bool isMissionLenDone() const { return missionLenDone; }
+    bool isMissionMaxDone() const { return missionMaxDone; }
+    bool isMissionGrowDone() const { return missionGrowDone; }
+    bool isMissionPoisonDone() const { return missionPoisonDone; }
+    bool isMissionGateDone() const { return missionGateDone; }
+    const ItemPool& getItems() const { return items; }
+    pair<int, int> getGateA() const { return gateA; }  // 게이트가 없으면 (-1, -1)
+    pair<int, int> getGateB() const { return gateB; }
+    const vector<Windmill>& getWindmills() const { return windmills; }
+
+    // 스냅샷 - 게임 상태 전체(맵, 뱀, 아이템, 게이트, 바람개비, 미션, 난수, 타이머)를 작은 바이트 버퍼로 저장
+    // 복원은 같은 크기/레벨 팩으로 만든 GameState에만 가능하고, 복원한 게임은 원래 게임과 똑같이 진행됨
+    // 형식이 틀리면 false를 돌려주고 상태는 그대로 둠
+    void saveSnapshot(vector<uint8_t>& out) const;
+    bool loadSnapshot(const vector<uint8_t>& in);
+
+    // 화면 갱신용 변경 칸 추적
+    void setDamageTracking(bool enabled);
+    const vector<int>& getDirtyCells() const { return dirtyCells; }
+    bool needsFullRedraw() const { return fullRedraw; }
+    void clearDamage();
+
+private:
+    friend class SimulationProbe;            // 벤치마크(bench.cpp)가 내부 단계를 직접 호출함
+
+    void tick();                             // 상태 갱신
+    void endGame(GameOverReason reason);     // 게임 오버 처리
+    void distributeItems();                  // 아이템 배치
+    void setupMap();                         // 맵 초기화
+    void setupStage();                       // 스테이지 세팅
+    void loadPackStage();                    // 레벨 팩에서 스테이지 세팅
+    void resetStage();                       // 스테이지 리셋
+    void fireTimer(const TimerEvent& event); // 발동한 타이머 처리
+    void regenerateGates();                  // 게이트 위치 다시 뽑기
+    bool consumeItem(int index);             // 머리 칸 아이템 효과 적용 - 게임이 계속되면 true
+    void useGate(const pair<int, int>& exit); // 게이트 통과 처리
+    void checkMissions();                    // 미션 진행 상황 갱신
+    void proceedNextStage();                 // 다음 스테이지로 이동
+    void addWindmill(int centerX, int centerY, int length, int spinTicks);  // 바람개비 추가
+    void spinWindmill(Windmill& windmill);   // 바람개비 회전 처리
+    bool gateInsideWindmill(const Windmill& windmill, const pair<int, int>& gate) const;  // 게이트가 바람개비 안에 있는지 확인
+    void setCell(int x, int y, Cell cell);   // 칸 변경 + 목록 갱신
+    void syncCell(int index);                // 칸 하나의 목록 소속 갱신
+    void rebuildCellIndex();                 // 빈 칸/벽 목록 재구성
+    int tailIndex() const;                   // 뱀 꼬리 칸 번호
+    int headIndex() const;                   // 뱀 머리 칸 번호
+    int localRadius(const ChunkedCellSet& cells, int need, int& count) const;  // 머리 주변에 need개 이상 있는 최소 반지름
+    bool pickFreeCell(int& x, int& y);       // 빈 칸 무작위 선택
+    bool pickGateCells(pair<int, int>& a, pair<int, int>& b);  // 게이트용 벽 두 칸 선택
+    bool decodeSnapshot(const vector<uint8_t>& in);  // 스냅샷을 이 상태에 풀어 넣음 - 실패하면 상태가 깨질 수 있음
+
+    Rng rng;                                 // 아이템/게이트 배치용 난수
+    const LevelPack* pack;                   // 스테이지 데이터 (없으면 기본 스테이지)
+    int itemCaps[ITEM_KIND_COUNT];           // 이번 스테이지 종류별 아이템 최대 개수
+
+    TimerWheel timers;                       // 시간 효과 예약 (틱 단위)
+    ItemPool items;                          // 맵 위의 모든 아이템
+
+    Serpent serpent;                         // 뱀 객체
+    int width, height;                       // 맵 크기
+    StageMap map;                            // 맵 정보
+    bool localSpawn;                         // 넓은 맵 - 아래 청크 집합을 씀
+    CellSet freeCells;                       // 아이템을 놓을 수 있는 빈 칸
+    CellSet wallCells;                       // 게이트가 될 수 있는 벽 칸
+    ChunkedCellSet freeChunks;               // 넓은 맵의 빈 칸 (청크별)
+    ChunkedCellSet wallChunks;               // 넓은 맵의 게이트 후보 벽 (청크별)
+    pair<int, int> gateA, gateB;             // 게이트 좌표
+    vector<Windmill> windmills;              // 스테이지의 바람개비들
+    vector<int> bladeCells;                  // 모든 바람개비의 각도별 날 칸 번호
+    CowArray<uint8_t> bladeCount;            // 칸별로 덮고 있는 날 수
+    int growScore, poisonScore, gateScore;
+    int maxLength;
+    int stageLevel;
+    int missionLen, missionGrow, missionPoison, missionGate;
+    int missionMaxLen;
+    bool missionLenDone, missionGrowDone, missionPoisonDone, missionGateDone;
+    bool missionMaxDone;
+    bool gatesActive;
+    TimerId gateTimer;                       // 게이트 재생성 타이머
+    TimerId speedTimer;                      // 속도 효과 해제 타이머
+
+    int totalTicks;                          // 게임 시작 이후 틱 수
+    int stageTicks;                          // 스테이지 시작 이후 틱 수
+    bool gameOver;
+    bool cleared;
+    GameOverReason overReason;               // 게임 오버 사유
+
+    bool trackDamage;                        // 변경 칸 추적 여부
+    bool fullRedraw;                         // 전체 다시 그리기 필요
+    vector<int> dirtyCells;                  // 마지막 화면 갱신 이후 바뀐 칸
+    CowArray<uint8_t> dirtyMark;             // 칸별 중복 기록 방지
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "simulation.hpp"
+#include "bytes.hpp"
+#include <cstring>
+
+// 스냅샷 형식 (리틀 엔디언, 정수는 따로 적지 않으면 varint)
+//   "SNKS" | 버전(u8) | width(u16) | height(u16) | 스테이지 수(u16) | 난수 state(u64) | inc(u64)
+//   틱/점수/미션 값 | 상태 비트(u8) | 오버 사유(u8) | 종류별 아이템 최대 개수 | 게이트 좌표(+1) | 게이트/속도 타이머
+//   맵(값 u8 + 반복 수, 아이템/게이트/날 포함) | 뱀 | 아이템 풀 | 타이머 휠
+//   빈 칸/벽 목록 (넓은 맵이면 청크 집합) | 바람개비 (날 칸 수는 각도에서 다시 계산)
+static const size_t SNAPSHOT_HEADER_BYTES = 4 + 1 + 2 + 2 + 2 + 8 + 8;
+
+// 음수일 수 있는 좌표는 1을 더해 저장 (-1 = 없음)
+static void writeCoord(vector<uint8_t>& out, const pair<int, int>& cell) {
+    writeVarint(out, static_cast<uint64_t>(cell.first + 1));
+    writeVarint(out, static_cast<uint64_t>(cell.second + 1));
+}
+
+static bool readInt(const vector<uint8_t>& in, size_t& pos, int& value, uint64_t limit = 0x7FFFFFFF) {
+    uint64_t raw;
+    if (!readVarint(in, pos, raw) || raw > limit) return false;
+    value = static_cast<int>(raw);
+    return true;
+}
+
+static bool readCoord(const vector<uint8_t>& in, size_t& pos, pair<int, int>& cell, int width, int height) {
+    int x, y;
+    if (!readInt(in, pos, x, static_cast<uint64_t>(width)) || !readInt(in, pos, y, static_cast<uint64_t>(height))) return false;
+    cell = { x - 1, y - 1 };
+    return (x == 0) == (y == 0);
+}
+
+// 스냅샷 저장
+void GameState::saveSnapshot(vector<uint8_t>& out) const {
+    out.assign({ 'S', 'N', 'K', 'S' });
+    out.push_back(SNAPSHOT_VERSION);
+    writeFixed(out, static_cast<uint64_t>(width), 2);
+    writeFixed(out, static_cast<uint64_t>(height), 2);
+    writeFixed(out, static_cast<uint64_t>(getStageCount()), 2);
+    writeFixed(out, rng.getState(), 8);
+    writeFixed(out, rng.getIncrement(), 8);
+
+    const int values[] = { totalTicks, stageTicks, stageLevel, growScore, poisonScore, gateScore, maxLength,
+                           missionLen, missionMaxLen, missionGrow, missionPoison, missionGate };
+    for (int value : values) writeVarint(out, static_cast<uint64_t>(value));
+    out.push_back(static_cast<uint8_t>((missionLenDone ? 1 : 0) | (missionMaxDone ? 2 : 0) | (missionGrowDone ? 4 : 0) |
+                                       (missionPoisonDone ? 8 : 0) | (missionGateDone ? 16 : 0) | (gatesActive ? 32 : 0) |
+                                       (gameOver ? 64 : 0) | (cleared ? 128 : 0)));
+    out.push_back(static_cast<uint8_t>(overReason));
+    for (int cap : itemCaps) writeVarint(out, static_cast<uint64_t>(cap));
+    writeCoord(out, gateA);
+    writeCoord(out, gateB);
+    writeVarint(out, gateTimer);
+    writeVarint(out, speedTimer);
+
+    // 맵 - 같은 값이 이어지는 구간 단위
+    int cells = width * height;
+    for (int i = 0; i < cells;) {
+        uint8_t value = map.atIndex(i);
+        int run = 1;
+        while (i + run < cells && map.atIndex(i + run) == value) ++run;
+        out.push_back(value);
+        writeVarint(out, static_cast<uint64_t>(run));
+        i += run;
+    }
+
+    serpent.save(out);
+    items.save(out);
+    timers.save(out);
+    if (localSpawn) {
+        freeChunks.save(out);
+        wallChunks.save(out);
+    } else {
+        freeCells.save(out);
+        wallCells.save(out);
+    }
+
+    writeVarint(out, windmills.size());
+    for (const Windmill& windmill : windmills) {
+        writeCoord(out, windmill.center);
+        writeVarint(out, static_cast<uint64_t>(windmill.length));
+        writeVarint(out, static_cast<uint64_t>(windmill.state));
+        writeVarint(out, static_cast<uint64_t>(windmill.spinTicks));
+        writeVarint(out, windmill.spinTimer);
+        for (int offset : windmill.maskOffset) writeVarint(out, static_cast<uint64_t>(offset));
+    }
+    writeVarint(out, bladeCells.size());
+    for (int cell : bladeCells) writeVarint(out, static_cast<uint64_t>(cell));
+}
+
+// 스냅샷 복원 - 복사본에 풀어 보고 성공했을 때만 바꿔 끼움 (복사는 페이지 공유라 쌈)
+bool GameState::loadSnapshot(const vector<uint8_t>& in) {
+    GameState restored(*this);
+    if (!restored.decodeSnapshot(in)) return false;
+    *this = std::move(restored);
+    return true;
+}
+
+// 스냅샷 해석 - 크기/스테이지 수가 다르거나 값이 범위를 벗어나면 false
+bool GameState::decodeSnapshot(const vector<uint8_t>& in) {
+    if (in.size() < SNAPSHOT_HEADER_BYTES || memcmp(in.data(), "SNKS", 4) != 0 || in[4] != SNAPSHOT_VERSION) {
+        return false;
+    }
+    if (static_cast<int>(readFixed(in, 5, 2)) != width || static_cast<int>(readFixed(in, 7, 2)) != height ||
+        static_cast<int>(readFixed(in, 9, 2)) != getStageCount()) {
+        return false;
+    }
+    rng.restore(readFixed(in, 11, 8), readFixed(in, 19, 8));
+    size_t pos = SNAPSHOT_HEADER_BYTES;
+
+    int* values[] = { &totalTicks, &stageTicks, &stageLevel, &growScore, &poisonScore, &gateScore, &maxLength,
+                      &missionLen, &missionMaxLen, &missionGrow, &missionPoison, &missionGate };
+    for (int* value : values) {
+        if (!readInt(in, pos, *value)) return false;
+    }
+    if (stageLevel < 1 || stageLevel > getStageCount() + 1 || in.size() - pos < 2) return false;
+    uint8_t flags = in[pos++];
+    uint8_t reason = in[pos++];
+    if (reason > OVER_SNAKE) return false;
+    missionLenDone = (flags & 1) != 0;
+    missionMaxDone = (flags & 2) != 0;
+    missionGrowDone = (flags & 4) != 0;
+    missionPoisonDone = (flags & 8) != 0;
+    missionGateDone = (flags & 16) != 0;
+    gatesActive = (flags & 32) != 0;
+    gameOver = (flags & 64) != 0;
+    cleared = (flags & 128) != 0;
+    overReason = static_cast<GameOverReason>(reason);
+    for (int& cap : itemCaps) {
+        if (!readInt(in, pos, cap)) return false;
+    }
+    uint64_t gate, speed;
+    if (!readCoord(in, pos, gateA, width, height) || !readCoord(in, pos, gateB, width, height) ||
+        !readVarint(in, pos, gate) || !readVarint(in, pos, speed)) {
+        return false;
+    }
+    gateTimer = gate;
+    speedTimer = speed;
+
+    // 맵
+    int cells = width * height;
+    for (int i = 0; i < cells;) {
+        uint64_t run;
+        if (pos >= in.size()) return false;
+        uint8_t value = in[pos++];
+        if (!readVarint(in, pos, run) || run == 0 || run > static_cast<uint64_t>(cells - i)) return false;
+        switch (value) {
+            case CELL_EMPTY: case CELL_WALL: case CELL_IMMUNE_WALL: case CELL_GROW:
+            case CELL_POISON: case CELL_GATE: case CELL_BOOST: case CELL_SLOW:
+                break;
+            default:
+                return false;
+        }
+        for (uint64_t k = 0; k < run; ++k) map.setIndex(i++, static_cast<Cell>(value));
+    }
+
+    if (!serpent.load(in, pos, in.size()) || !items.load(in, pos, in.size()) || !timers.load(in, pos, in.size()) ||
+        !timers.validId(gateTimer) || !timers.validId(speedTimer) || !timers.payloadsBelow(TIMER_ITEM_EXPIRE, cells)) {
+        return false;
+    }
+    freeCells.clear();
+    wallCells.clear();
+    freeChunks.clear();
+    wallChunks.clear();
+    if (localSpawn ? !freeChunks.load(in, pos, in.size()) || !wallChunks.load(in, pos, in.size())
+                   : !freeCells.load(in, pos, in.size()) || !wallCells.load(in, pos, in.size())) {
+        return false;
+    }
+
+    // 바람개비 - 날 칸 수는 현재 각도의 마스크로 다시 셈
+    uint64_t count;
+    if (!readVarint(in, pos, count) || count > static_cast<uint64_t>(cells)) return false;
+    windmills.resize(count);
+    for (Windmill& windmill : windmills) {
+        uint64_t spinTimer;
+        if (!readCoord(in, pos, windmill.center, width, height) || !readInt(in, pos, windmill.length) ||
+            !readInt(in, pos, windmill.state, 7) || !readInt(in, pos, windmill.spinTicks) || !readVarint(in, pos, spinTimer)) {
+            return false;
+        }
+        windmill.spinTimer = spinTimer;
+        if (!timers.validId(windmill.spinTimer)) return false;
+        for (int& offset : windmill.maskOffset) {
+            if (!readInt(in, pos, offset)) return false;
+        }
+    }
+    if (!timers.payloadsBelow(TIMER_WINDMILL_SPIN, static_cast<int>(windmills.size()))) return false;
+    if (!readVarint(in, pos, count) || count > static_cast<uint64_t>(8 * 2) * cells) return false;
+    bladeCells.resize(count);
+    for (int& cell : bladeCells) {
+        if (!readInt(in, pos, cell, static_cast<uint64_t>(cells - 1))) return false;
+    }
+    bladeCount.fill(0);
+    for (const Windmill& windmill : windmills) {
+        for (int k = 0; k < 8; ++k) {
+            if (windmill.maskOffset[k] > windmill.maskOffset[k + 1]) return false;
+        }
+        if (windmill.maskOffset[8] > static_cast<int>(bladeCells.size())) return false;
+        for (int k = windmill.maskOffset[windmill.state]; k < windmill.maskOffset[windmill.state + 1]; ++k) {
+            ++bladeCount.write(bladeCells[k]);
+        }
+    }
+    if (pos != in.size()) return false;
+
+    // 화면은 통째로 다시 그림
+    clearDamage();
+    fullRedraw = true;
+    return true;
+}
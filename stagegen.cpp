@@ -0,0 +1,195 @@
+#include "stagegen.hpp"
+#include <algorithm>
+
+// 4방향 이웃 (UP, DOWN, LEFT, RIGHT)
+static const int neighborX[4] = { 0, 0, -1, 1 };
+static const int neighborY[4] = { -1, 1, 0, 0 };
+
+// 기본 옵션
+GeneratorOptions defaultGeneratorOptions(int width, int height) {
+    GeneratorOptions options;
+    options.width = width;
+    options.height = height;
+    int area = (width - 2) * (height - 2);
+    options.minSegments = max(1, area / 400);
+    options.maxSegments = max(2, area / 90);
+    options.maxSegmentLength = max(3, min(width, height) / 3);
+    return options;
+}
+
+// 스테이지 검사
+bool StageValidator::validate(const StageData& stage, const char*& reason) {
+    const int width = stage.width, height = stage.height;
+    const uint8_t* cells = stage.cells.data();
+
+    // 0) 테두리 - 벽이 아니면 뱀이 맵 밖으로 나감
+    if (!borderIsWall(cells, width, height)) {
+        reason = "map border must be walls";
+        return false;
+    }
+
+    // 1) 뱀 시작 칸
+    if (!spawnFits(cells, width, height, stage.spawnX, stage.spawnY, stage.spawnDir)) {
+        reason = "snake spawn must fit on empty cells";
+        return false;
+    }
+
+    // 2) 시작 위치에서 모든 빈 칸에 닿는지
+    seen.assign(static_cast<size_t>(width) * height, 0);
+    queue.clear();
+    int start = stage.spawnY * width + stage.spawnX;
+    seen[start] = 1;
+    queue.push_back(start);
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int index = queue[head];
+        int x = index % width, y = index / width;
+        for (int d = 0; d < 4; ++d) {
+            int nx = x + neighborX[d], ny = y + neighborY[d];
+            if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+            int next = ny * width + nx;
+            if (seen[next] || cells[next] != 0) continue;
+            seen[next] = 1;
+            queue.push_back(next);
+        }
+    }
+    for (size_t i = 0; i < stage.cells.size(); ++i) {
+        if (cells[i] == 0 && !seen[i]) {
+            reason = "free cells unreachable from spawn";
+            return false;
+        }
+    }
+
+    // 3) 게이트 후보 벽마다 나갈 칸이 있는지
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (cells[y * width + x] != 1) continue;
+            bool exit = false;
+            for (int d = 0; d < 4 && !exit; ++d) {
+                int nx = x + neighborX[d], ny = y + neighborY[d];
+                exit = nx >= 0 && ny >= 0 && nx < width && ny < height && cells[ny * width + nx] == 0;
+            }
+            if (!exit) {
+                reason = "gate wall without an exit";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// 생성기
+StageGenerator::StageGenerator(const GeneratorOptions& options, uint64_t seed)
+    : options(options), rng(seed), attempts(0), rejected(0) {}
+
+// 뱀 시작 구역 - 몸통 세 칸과 앞쪽 네 칸, 그 위아래 한 줄은 비워 둠
+bool StageGenerator::inSpawnZone(const StageData& stage, int x, int y) const {
+    return y >= stage.spawnY - 1 && y <= stage.spawnY + 1 && x >= stage.spawnX - 3 && x <= stage.spawnX + 4;
+}
+
+// 테두리 + 무작위 가로/세로/ㄱ자 벽 조각
+void StageGenerator::build(StageData& stage, int segments) {
+    const int width = options.width, height = options.height;
+    initStageData(stage, width, height);
+    uint8_t* cells = stage.cells.data();
+
+    for (int x = 0; x < width; ++x) {
+        cells[x] = 1;
+        cells[(height - 1) * width + x] = 1;
+    }
+    for (int y = 0; y < height; ++y) {
+        cells[y * width] = 1;
+        cells[y * width + width - 1] = 1;
+    }
+    cells[0] = cells[width - 1] = 2;
+    cells[(height - 1) * width] = cells[(height - 1) * width + width - 1] = 2;
+
+    for (int s = 0; s < segments; ++s) {
+        int x = 2 + static_cast<int>(rng.below(width - 4));
+        int y = 2 + static_cast<int>(rng.below(height - 4));
+        int length = 2 + static_cast<int>(rng.below(options.maxSegmentLength - 1));
+        int dir = static_cast<int>(rng.below(4));
+        bool bend = rng.below(4) == 0;  // 4분의 1은 ㄱ자
+
+        for (int i = 0; i < length; ++i) {
+            if (bend && i == length / 2) dir = (dir < 2) ? 2 + static_cast<int>(rng.below(2)) : static_cast<int>(rng.below(2));
+            if (x < 1 || y < 1 || x >= width - 1 || y >= height - 1) break;
+            if (!inSpawnZone(stage, x, y)) cells[y * width + x] = 1;
+            x += neighborX[dir];
+            y += neighborY[dir];
+        }
+    }
+}
+
+// 시작 위치에서 닿지 않는 빈 칸(벽에 갇힌 구멍)은 벽으로 메움
+int StageGenerator::fillPockets(StageData& stage) {
+    const int width = stage.width, height = stage.height;
+    uint8_t* cells = stage.cells.data();
+
+    seen.assign(stage.cells.size(), 0);
+    queue.clear();
+    int start = stage.spawnY * width + stage.spawnX;
+    seen[start] = 1;
+    queue.push_back(start);
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int index = queue[head];
+        int x = index % width, y = index / width;
+        for (int d = 0; d < 4; ++d) {
+            int nx = x + neighborX[d], ny = y + neighborY[d];
+            if (nx < 0 || ny < 0 || nx >= width || ny >= height) continue;
+            int next = ny * width + nx;
+            if (seen[next] || cells[next] != 0) continue;
+            seen[next] = 1;
+            queue.push_back(next);
+        }
+    }
+    for (size_t i = 0; i < stage.cells.size(); ++i) {
+        if (cells[i] == 0 && !seen[i]) cells[i] = 1;
+    }
+    return static_cast<int>(queue.size());
+}
+
+// 주변이 모두 벽인 벽은 게이트가 되면 나갈 곳이 없으므로 모서리 벽으로 바꿈
+void StageGenerator::sealDeadWalls(StageData& stage) {
+    const int width = stage.width, height = stage.height;
+    uint8_t* cells = stage.cells.data();
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (cells[y * width + x] != 1) continue;
+            bool exit = false;
+            for (int d = 0; d < 4 && !exit; ++d) {
+                int nx = x + neighborX[d], ny = y + neighborY[d];
+                exit = nx >= 0 && ny >= 0 && nx < width && ny < height && cells[ny * width + nx] == 0;
+            }
+            if (!exit) cells[y * width + x] = 2;
+        }
+    }
+}
+
+// 스테이지 생성 - 구멍을 메운 뒤 빈 칸이 안쪽의 절반 이상 남고 검사를 통과할 때까지 다시 뽑음
+void StageGenerator::generate(StageData& stage, double difficulty) {
+    difficulty = max(0.0, min(1.0, difficulty));
+    int segments = options.minSegments +
+                   static_cast<int>((options.maxSegments - options.minSegments) * difficulty + 0.5);
+
+    const int interior = (options.width - 2) * (options.height - 2);
+    const char* reason = nullptr;
+    while (true) {
+        ++attempts;
+        build(stage, segments);
+        int open = fillPockets(stage);
+        sealDeadWalls(stage);
+        if (open * 2 >= interior && validator.validate(stage, reason)) break;
+        ++rejected;
+        if (segments > 0 && rejected % 8 == 0) --segments;  // 너무 빽빽하면 조금씩 줄임
+    }
+
+    stage.mission[2] = 1 + static_cast<int>(difficulty * 3 + 0.5);  // grow
+}
+
+// 난이도 순 생성
+void StageGenerator::generateCurriculum(int count, vector<StageData>& stages) {
+    stages.resize(count);
+    for (int i = 0; i < count; ++i) {
+        generate(stages[i], count > 1 ? static_cast<double>(i) / (count - 1) : 0.0);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef STAGEGEN_HPP
+#define STAGEGEN_HPP
+
+#include "levelpack.hpp"
+#include "rng.hpp"
+#include <vector>
+
+using namespace std;
+
+// 생성 옵션
+struct GeneratorOptions {
+    int width, height;       // 맵 크기 (테두리 포함, 최소 10 x 8)
+    int minSegments;         // 벽 조각 수 범위 (난이도 0 -> 1)
+    int maxSegments;
+    int maxSegmentLength;    // 벽 조각 최대 길이
+};
+
+// 기본 옵션 - 맵 넓이에 맞춰 벽 조각 수를 정함
+GeneratorOptions defaultGeneratorOptions(int width, int height);
+
+// StageValidator 클래스 - 스테이지가 실제로 끝까지 플레이 가능한지 검사함
+//   0) 테두리 칸이 모두 벽
+//   1) 뱀 시작 세 칸이 맵 안쪽 빈 칸
+//   2) 모든 빈 칸이 시작 위치에서 BFS로 닿음
+//   3) 게이트가 될 수 있는 벽(CELL_WALL)마다 useGate()가 나갈 빈 칸이 하나 이상 있음
+// 바람개비 날은 실행 중에 움직이므로 검사하지 않음
+class StageValidator {
+public:
+    // 실패 시 false, reason에 이유
+    bool validate(const StageData& stage, const char*& reason);
+
+private:
+    vector<int> queue;        // BFS 큐 (재사용)
+    vector<uint8_t> seen;     // 방문 표시 (재사용)
+};
+
+// StageGenerator 클래스 - 무작위 벽 조각으로 스테이지를 만들고 검사를 통과한 것만 돌려줌
+// 벽에 갇힌 빈 칸은 벽으로 메우므로 버려지는 것은 맵이 한쪽으로 크게 잘린 경우뿐임
+class StageGenerator {
+public:
+    StageGenerator(const GeneratorOptions& options, uint64_t seed);
+
+    // 스테이지 하나 생성 - difficulty(0~1)가 클수록 벽이 많고 성장 미션이 큼
+    void generate(StageData& stage, double difficulty);
+
+    // count개를 난이도 순으로 생성 (0 -> 1)
+    void generateCurriculum(int count, vector<StageData>& stages);
+
+    long getAttempts() const { return attempts; }
+    long getRejected() const { return rejected; }
+
+private:
+    void build(StageData& stage, int segments);  // 벽 배치 한 번
+    int fillPockets(StageData& stage);           // 시작 위치에서 닿지 않는 빈 칸을 벽으로, 남은 빈 칸 수 반환
+    void sealDeadWalls(StageData& stage);        // 나갈 곳 없는 벽은 모서리 벽으로
+    bool inSpawnZone(const StageData& stage, int x, int y) const;
+
+    GeneratorOptions options;
+    Rng rng;
+    StageValidator validator;
+    vector<int> queue;        // 구멍 메우기 BFS 큐 (재사용)
+    vector<uint8_t> seen;
+    long attempts;
+    long rejected;
+};
+
+#endif
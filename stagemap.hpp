@@ -0,0 +1,57 @@
+#ifndef STAGEMAP_HPP
+#define STAGEMAP_HPP
+
+#include "cowarray.hpp"
+#include <cstdint>
+
+using namespace std;
+
+// 칸 종류 - 값은 기존 맵 코드와 동일하게 유지함
+enum Cell : uint8_t {
+    CELL_EMPTY = 0,        // 빈 칸
+    CELL_WALL = 1,         // 벽 (게이트 가능)
+    CELL_IMMUNE_WALL = 2,  // 모서리 벽 (게이트 불가)
+    CELL_GROW = 5,         // 성장 아이템
+    CELL_POISON = 6,       // 독 아이템
+    CELL_GATE = 7,         // 게이트
+    CELL_BOOST = 9,        // 속도 증가 아이템
+    CELL_SLOW = 10         // 속도 감소 아이템
+};
+
+// StageMap 클래스 - uint8_t 칸 배열(y * width + x)에 저장하는 맵
+// 칸 배열은 copy-on-write라 맵 복사는 페이지 포인터만 복사함
+class StageMap {
+public:
+    StageMap(int width, int height)
+        : width(width), height(height), cells(width * height, CELL_EMPTY) {}
+
+    // 전체를 빈 칸으로 - 할당은 재사용
+    void clear() { cells.fill(CELL_EMPTY); }
+
+    // 지형(빈 칸/벽/모서리 벽)만 담긴 칸 배열로 채움 - 그 밖의 값은 빈 칸으로 취급
+    void assign(const uint8_t* source) {
+        for (size_t i = 0; i < cells.size(); ++i) {
+            cells.write(i) = source[i] <= CELL_IMMUNE_WALL ? source[i] : static_cast<uint8_t>(CELL_EMPTY);
+        }
+    }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int index(int x, int y) const { return y * width + x; }
+
+    Cell at(int x, int y) const { return static_cast<Cell>(cells[y * width + x]); }
+    Cell atIndex(int i) const { return static_cast<Cell>(cells[i]); }
+    void set(int x, int y, Cell cell) { cells.write(y * width + x) = cell; }
+    void setIndex(int i, Cell cell) { cells.write(i) = cell; }
+
+    // y행부터 rows행을 out으로 복사 (순차 접근용)
+    void copyRows(int y, int rows, uint8_t* out) const {
+        cells.copyOut(static_cast<size_t>(y) * width, static_cast<size_t>(rows) * width, out);
+    }
+
+private:
+    int width, height;        // 맵 크기
+    CowArray<uint8_t> cells;  // 칸 정보 (y * width + x)
+};
+
+#endif
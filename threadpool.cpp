@@ -0,0 +1,113 @@
+#include "threadpool.hpp"
+#include <algorithm>
+
+// 생성자 - 작업 스레드 생성
+ThreadPool::ThreadPool(int threads)
+    : stopping(false), generation(0), currentFn(nullptr), currentContext(nullptr), remaining(0) {
+    if (threads <= 0) threads = static_cast<int>(thread::hardware_concurrency());
+    if (threads <= 0) threads = 1;
+
+    for (int i = 0; i < threads; ++i) queues.emplace_back(new WorkQueue());
+    for (int i = 0; i < threads - 1; ++i) workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+// 소멸자 - 작업 스레드 정리
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> guard(wakeLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) worker.join();
+}
+
+// 조각을 각 큐에 나눠 넣고, 호출 스레드도 함께 처리
+void ThreadPool::run(int count, int grain, RangeFn fn, void* context) {
+    if (count <= 0) return;
+    if (grain < 1) grain = 1;
+
+    // 스레드가 하나뿐이거나 조각이 하나면 바로 실행 (작업 스레드를 깨우지 않음)
+    int chunks = (count + grain - 1) / grain;
+    if (workers.empty() || chunks == 1) {
+        fn(context, 0, count);
+        return;
+    }
+
+    currentFn = fn;
+    currentContext = context;
+    remaining.store(chunks);
+
+    // 연속된 조각을 같은 큐에 몰아서 넣음 (캐시 지역성)
+    int threads = size();
+    for (int q = 0; q < threads; ++q) {
+        WorkQueue& queue = *queues[q];
+        lock_guard<mutex> guard(queue.lock);
+        queue.ranges.clear();
+        queue.head = 0;
+        int first = chunks * q / threads;
+        int last = chunks * (q + 1) / threads;
+        for (int c = first; c < last; ++c) {
+            Range range = { c * grain, min(count, (c + 1) * grain) };
+            queue.ranges.push_back(range);
+        }
+    }
+
+    {
+        lock_guard<mutex> guard(wakeLock);
+        ++generation;
+    }
+    wake.notify_all();
+
+    // 호출 스레드는 마지막 큐의 주인
+    int self = threads - 1;
+    while (remaining.load() > 0) {
+        if (!runOne(self)) this_thread::yield();
+    }
+}
+
+// 작업 스레드 본체
+void ThreadPool::workerLoop(int id) {
+    long seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guard(wakeLock);
+            wake.wait(guard, [&]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        while (runOne(id)) {}
+    }
+}
+
+// 작업 하나 실행
+bool ThreadPool::runOne(int id) {
+    Range range;
+    if (!popOwn(id, range) && !steal(id, range)) return false;
+    currentFn(currentContext, range.begin, range.end);
+    remaining.fetch_sub(1);
+    return true;
+}
+
+// 자기 큐 뒤에서 꺼내기
+bool ThreadPool::popOwn(int id, Range& range) {
+    WorkQueue& queue = *queues[id];
+    lock_guard<mutex> guard(queue.lock);
+    if (queue.head >= queue.ranges.size()) return false;
+    range = queue.ranges.back();
+    queue.ranges.pop_back();
+    return true;
+}
+
+// 다른 큐 앞에서 훔치기
+bool ThreadPool::steal(int id, Range& range) {
+    int threads = size();
+    for (int offset = 1; offset < threads; ++offset) {
+        WorkQueue& queue = *queues[(id + offset) % threads];
+        lock_guard<mutex> guard(queue.lock);
+        if (queue.head < queue.ranges.size()) {
+            range = queue.ranges[queue.head++];
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,72 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+
+using namespace std;
+
+// ThreadPool 클래스 - 작업 훔치기(work-stealing) 방식 스레드 풀
+// 각 스레드가 자기 큐의 뒤에서 꺼내고, 비면 다른 큐의 앞에서 훔쳐 옴
+class ThreadPool {
+public:
+    // 생성자 - threads가 0 이하이면 코어 수만큼 (호출 스레드 포함)
+    explicit ThreadPool(int threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 작업에 참여하는 스레드 수 (호출 스레드 포함)
+    int size() const { return static_cast<int>(queues.size()); }
+
+    // [0, count)를 grain 크기 조각으로 나눠 병렬 실행 - 모두 끝나야 반환
+    // body(begin, end) 형태로 호출됨
+    template <typename Body>
+    void parallelFor(int count, int grain, Body& body) {
+        run(count, grain, &invoke<Body>, &body);
+    }
+
+private:
+    typedef void (*RangeFn)(void* context, int begin, int end);
+
+    struct Range {
+        int begin, end;
+    };
+
+    // 스레드별 작업 큐 - 주인은 뒤에서, 도둑은 앞에서 꺼냄
+    struct WorkQueue {
+        mutex lock;
+        vector<Range> ranges;
+        size_t head = 0;
+    };
+
+    template <typename Body>
+    static void invoke(void* context, int begin, int end) {
+        (*static_cast<Body*>(context))(begin, end);
+    }
+
+    void run(int count, int grain, RangeFn fn, void* context);
+    void workerLoop(int id);
+    bool runOne(int id);                 // 작업 하나 실행 - 없으면 false
+    bool popOwn(int id, Range& range);   // 자기 큐에서 꺼내기
+    bool steal(int id, Range& range);    // 다른 큐에서 훔치기
+
+    vector<thread> workers;
+    vector<unique_ptr<WorkQueue>> queues;  // 마지막 큐는 호출 스레드용
+
+    mutex wakeLock;
+    condition_variable wake;
+    bool stopping;
+    long generation;                     // 새 작업 묶음마다 증가
+
+    RangeFn currentFn;                   // 현재 작업 함수
+    void* currentContext;
+    atomic<int> remaining;               // 아직 끝나지 않은 조각 수
+};
+
+#endif
@@ -0,0 +1,228 @@
+#include "timerwheel.hpp"
+#include "bytes.hpp"
+#include <algorithm>
+
+// 생성자
+TimerWheel::TimerWheel() : heads(DUE_LIST + 1, -1), tails(DUE_LIST + 1, -1), now(0) {
+    nodes.reserve(64);
+    freeNodes.reserve(64);
+}
+
+// 전체 취소 - 노드 세대는 유지해서 예전 식별자가 다시 맞지 않게 함
+void TimerWheel::clear(int tick) {
+    freeNodes.clear();
+    for (int i = static_cast<int>(nodes.size()) - 1; i >= 0; --i) {
+        nodes[i].list = -1;
+        freeNodes.push_back(i);
+    }
+    fill(heads.begin(), heads.end(), -1);
+    fill(tails.begin(), tails.end(), -1);
+    now = tick;
+}
+
+// 발동 틱에 맞는 슬롯 - now와 처음 달라지는 6비트 묶음의 레벨에 둠
+int TimerWheel::listFor(int when) const {
+    if (when <= now) return DUE_LIST;
+
+    uint32_t diff = static_cast<uint32_t>(when) ^ static_cast<uint32_t>(now);
+    int level = 0;
+    while (level < LEVELS - 1 && (diff >> (SLOT_BITS * (level + 1))) != 0) ++level;
+    int slot = (when >> (SLOT_BITS * level)) & (SLOTS - 1);
+    return level * SLOTS + slot;
+}
+
+// 목록 끝에 추가
+void TimerWheel::link(int node, int list) {
+    Node& n = nodes[node];
+    n.list = list;
+    n.next = -1;
+    n.prev = tails[list];
+    if (tails[list] >= 0) nodes[tails[list]].next = node;
+    else heads[list] = node;
+    tails[list] = node;
+}
+
+// 목록에서 제거
+void TimerWheel::unlink(int node) {
+    Node& n = nodes[node];
+    if (n.prev >= 0) nodes[n.prev].next = n.next;
+    else heads[n.list] = n.next;
+    if (n.next >= 0) nodes[n.next].prev = n.prev;
+    else tails[n.list] = n.prev;
+}
+
+// 빈 노드로 반환
+void TimerWheel::release(int node) {
+    nodes[node].list = -1;
+    freeNodes.push_back(node);
+}
+
+// 타이머 예약
+TimerId TimerWheel::schedule(int when, TimerKind kind, int payload) {
+    int node;
+    if (!freeNodes.empty()) {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        node = static_cast<int>(nodes.size());
+        nodes.push_back(Node());
+        nodes[node].generation = 0;
+    }
+
+    Node& n = nodes[node];
+    n.when = when;
+    n.kind = kind;
+    n.payload = payload;
+    ++n.generation;
+    link(node, listFor(when));
+
+    return (static_cast<uint64_t>(n.generation) << 32) | static_cast<uint32_t>(node);
+}
+
+// 예약 취소
+bool TimerWheel::cancel(TimerId id) {
+    if (!validId(id) || id == NO_TIMER) return false;
+    int node = static_cast<int>(id & 0xFFFFFFFFu);
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+
+    Node& n = nodes[node];
+    if (n.list < 0 || n.generation != generation) return false;
+    unlink(node);
+    release(node);
+    return true;
+}
+
+// 현재 슬롯의 노드를 꺼내 다시 배치 - now 기준으로 더 낮은 레벨에 들어감
+void TimerWheel::cascade(int level) {
+    int list = level * SLOTS + ((now >> (SLOT_BITS * level)) & (SLOTS - 1));
+    int node = heads[list];
+    heads[list] = tails[list] = -1;
+    while (node >= 0) {
+        int next = nodes[node].next;
+        link(node, listFor(nodes[node].when));
+        node = next;
+    }
+}
+
+// 한 틱씩 진행하며 발동 목록에 모음
+void TimerWheel::advance(int target) {
+    while (now < target) {
+        ++now;
+
+        // 상위 레벨 경계를 지났으면 위에서부터 내려보냄
+        int top = 0;
+        while (top < LEVELS - 1 && (now & ((1 << (SLOT_BITS * (top + 1))) - 1)) == 0) ++top;
+        for (int level = top; level >= 1; --level) cascade(level);
+
+        // 레벨 0 슬롯은 모두 이번 틱에 발동
+        int list = now & (SLOTS - 1);
+        int node = heads[list];
+        heads[list] = tails[list] = -1;
+        while (node >= 0) {
+            int next = nodes[node].next;
+            link(node, DUE_LIST);
+            node = next;
+        }
+    }
+}
+
+// 발동한 타이머 꺼내기
+bool TimerWheel::popDue(TimerEvent& event) {
+    int node = heads[DUE_LIST];
+    if (node < 0) return false;
+
+    unlink(node);
+    event.kind = nodes[node].kind;
+    event.payload = nodes[node].payload;
+    release(node);
+    return true;
+}
+
+// 스냅샷 저장 - 노드(세대/발동 틱/종류), 비어 있지 않은 목록의 노드 순서, 빈 노드 순서
+void TimerWheel::save(vector<uint8_t>& out) const {
+    writeVarint(out, static_cast<uint64_t>(now));
+    writeVarint(out, nodes.size());
+    for (const Node& n : nodes) {
+        writeVarint(out, n.generation);
+        writeVarint(out, static_cast<uint64_t>(n.when));
+        writeVarint(out, static_cast<uint64_t>(n.payload));
+        out.push_back(n.kind);
+    }
+
+    int lists = 0;
+    for (int list = 0; list <= DUE_LIST; ++list) lists += heads[list] >= 0;
+    writeVarint(out, static_cast<uint64_t>(lists));
+    for (int list = 0; list <= DUE_LIST; ++list) {
+        if (heads[list] < 0) continue;
+        int length = 0;
+        for (int node = heads[list]; node >= 0; node = nodes[node].next) ++length;
+        writeVarint(out, static_cast<uint64_t>(list));
+        writeVarint(out, static_cast<uint64_t>(length));
+        for (int node = heads[list]; node >= 0; node = nodes[node].next) writeVarint(out, static_cast<uint64_t>(node));
+    }
+
+    writeVarint(out, freeNodes.size());
+    for (int node : freeNodes) writeVarint(out, static_cast<uint64_t>(node));
+}
+
+// 예약된 kind 타이머의 payload 검사
+bool TimerWheel::payloadsBelow(TimerKind kind, int limit) const {
+    for (const Node& n : nodes) {
+        if (n.list >= 0 && n.kind == kind && n.payload >= limit) return false;
+    }
+    return true;
+}
+
+// 스냅샷 복원 - 목록에 한 번씩 들어간 노드와 빈 노드가 정확히 전체를 덮어야 함
+bool TimerWheel::load(const vector<uint8_t>& in, size_t& pos, size_t end) {
+    clear(0);
+    nodes.clear();
+    freeNodes.clear();
+
+    uint64_t value, count;
+    if (!readVarint(in, pos, end, value) || value > 0x7FFFFFFF) return false;
+    now = static_cast<int>(value);
+    if (!readVarint(in, pos, end, count) || count > end - pos) return false;
+    nodes.resize(count);
+    for (Node& n : nodes) {
+        uint64_t generation, when, payload;
+        if (!readVarint(in, pos, end, generation) || !readVarint(in, pos, end, when) ||
+            !readVarint(in, pos, end, payload) || pos >= end) {
+            return false;
+        }
+        uint8_t kind = in[pos++];
+        if (generation > 0xFFFFFFFFu || when > 0x7FFFFFFF || payload > 0x7FFFFFFF || kind > TIMER_STAGE_TIMEOUT) return false;
+        n.generation = static_cast<uint32_t>(generation);
+        n.when = static_cast<int>(when);
+        n.payload = static_cast<int>(payload);
+        n.kind = static_cast<TimerKind>(kind);
+        n.list = -1;
+    }
+
+    uint64_t lists;
+    if (!readVarint(in, pos, end, lists) || lists > static_cast<uint64_t>(DUE_LIST + 1)) return false;
+    size_t linked = 0;
+    for (uint64_t i = 0; i < lists; ++i) {
+        uint64_t list, length;
+        if (!readVarint(in, pos, end, list) || list > static_cast<uint64_t>(DUE_LIST) || heads[list] >= 0 ||
+            !readVarint(in, pos, end, length) || length == 0 || length > nodes.size()) {
+            return false;
+        }
+        for (uint64_t k = 0; k < length; ++k) {
+            uint64_t node;
+            if (!readVarint(in, pos, end, node) || node >= nodes.size() || nodes[node].list >= 0) return false;
+            link(static_cast<int>(node), static_cast<int>(list));
+        }
+        linked += length;
+    }
+
+    if (!readVarint(in, pos, end, count) || linked + count != nodes.size()) return false;
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t node;
+        if (!readVarint(in, pos, end, node) || node >= nodes.size() || nodes[node].list >= 0) return false;
+        nodes[node].list = -2;  // 중복 확인용 표시
+        freeNodes.push_back(static_cast<int>(node));
+    }
+    for (int node : freeNodes) nodes[node].list = -1;
+    return true;
+}
@@ -0,0 +1,88 @@
+#ifndef TIMERWHEEL_HPP
+#define TIMERWHEEL_HPP
+
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// 틱 타이머 종류 - 게임의 모든 시간 효과
+enum TimerKind : uint8_t {
+    TIMER_ITEM_EXPIRE,    // 아이템 만료 (payload = 칸 번호)
+    TIMER_GATE_REGEN,     // 게이트 재생성
+    TIMER_SPEED_RESET,    // 속도 효과 해제
+    TIMER_WINDMILL_SPIN,  // 바람개비 회전
+    TIMER_STAGE_TIMEOUT   // 스테이지 제한 시간
+};
+
+// 발동한 타이머
+struct TimerEvent {
+    TimerKind kind;
+    int payload;
+};
+
+// 타이머 식별자 - 상위 32비트 세대, 하위 32비트 노드 번호 (0은 없음)
+typedef uint64_t TimerId;
+const TimerId NO_TIMER = 0;
+
+// TimerWheel 클래스 - 틱 단위 계층형 타이밍 휠
+// 레벨 l의 슬롯 하나는 64^l 틱을 덮고, 경계를 지날 때 아래 레벨로 내려보냄
+// 예약/취소는 O(1), 한 틱 진행은 그 틱에 발동하는 타이머 수만큼만 비용이 듦
+class TimerWheel {
+public:
+    TimerWheel();
+
+    // 모든 타이머 취소 후 현재 틱을 now로 맞춤 - 할당은 재사용
+    void clear(int now);
+
+    // when 틱에 발동할 타이머 예약 (이미 지난 틱이면 다음 advance()에서 발동)
+    TimerId schedule(int when, TimerKind kind, int payload = 0);
+
+    // 예약 취소 - 이미 발동했거나 없는 타이머면 false
+    bool cancel(TimerId id);
+
+    // now 틱까지 진행 - 발동한 타이머는 popDue()로 꺼냄
+    void advance(int now);
+
+    // 발동한 타이머 하나 꺼내기 (예약 순서대로) - 없으면 false
+    bool popDue(TimerEvent& event);
+
+    int getNow() const { return now; }
+
+    // 스냅샷 저장/복원 - 노드 번호와 세대, 목록 순서를 그대로 두므로 기존 TimerId와 발동 순서가 유지됨
+    // 형식이 틀리면 false (이때 휠 상태는 쓸 수 없음)
+    void save(vector<uint8_t>& out) const;
+    bool load(const vector<uint8_t>& in, size_t& pos, size_t end);
+
+    // 복원한 값 검사용 - id가 NO_TIMER이거나 있는 노드를 가리키는지, 예약된 kind 타이머의 payload가 모두 limit 미만인지
+    bool validId(TimerId id) const { return id == NO_TIMER || (id & 0xFFFFFFFFu) < nodes.size(); }
+    bool payloadsBelow(TimerKind kind, int limit) const;
+
+private:
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const int LEVELS = 4;                  // 64^4 틱 (약 116시간)까지 정확히 배치
+    static const int DUE_LIST = LEVELS * SLOTS;   // 발동 대기 목록 번호
+
+    struct Node {
+        int when;
+        int payload;
+        int prev, next;       // 같은 목록 안의 이웃 (-1이면 끝)
+        int list;             // 속한 목록 (-1이면 빈 노드)
+        uint32_t generation;  // 노드 재사용 구분용
+        TimerKind kind;
+    };
+
+    int listFor(int when) const;      // 발동 틱에 맞는 슬롯 목록
+    void link(int node, int list);    // 목록 끝에 추가
+    void unlink(int node);            // 목록에서 제거
+    void release(int node);           // 빈 노드로 반환
+    void cascade(int level);          // 현재 슬롯 노드를 아래 레벨로 재배치
+
+    vector<Node> nodes;
+    vector<int> freeNodes;
+    vector<int> heads, tails;         // 목록별 처음/끝 노드
+    int now;                          // 마지막으로 진행한 틱
+};
+
+#endif